@@ -22,6 +22,12 @@
 
 #include "gslrandomgen.h"
 
+// C++ includes:
+#include <cstring>
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 #ifdef HAVE_GSL
 
 // nothing if GSL 1.2 or later not available
@@ -64,6 +70,26 @@ librandom::GslRandomGen::add_gsl_rngs( Dictionary& rngdict )
   }
 }
 
+void
+librandom::GslRandomGen::get_state( std::vector< unsigned long >& state ) const
+{
+  const size_t size = gsl_rng_size( rng_ );
+  state.assign(
+    ( size + sizeof( unsigned long ) - 1 ) / sizeof( unsigned long ), 0 );
+  std::memcpy( &state[ 0 ], gsl_rng_state( rng_ ), size );
+}
+
+void
+librandom::GslRandomGen::set_state( const std::vector< unsigned long >& state )
+{
+  const size_t size = gsl_rng_size( rng_ );
+  if ( state.size() * sizeof( unsigned long ) < size )
+  {
+    throw UnsuitableRNG( "Invalid state for GSL random generator." );
+  }
+  std::memcpy( gsl_rng_state( rng_ ), &state[ 0 ], size );
+}
+
 librandom::GslRNGFactory::GslRNGFactory( gsl_rng_type const* const t )
   : gsl_rng_( t )
 {
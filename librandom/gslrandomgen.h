@@ -83,6 +83,9 @@ public:
     return RngPtr( new GslRandomGen( rng_type_, s ) );
   }
 
+  void get_state( std::vector< unsigned long >& ) const;
+  void set_state( const std::vector< unsigned long >& );
+
 
 private:
   void seed_( unsigned long );
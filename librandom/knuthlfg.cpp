@@ -30,6 +30,12 @@
 
 #include "knuthlfg.h"
 
+// C++ includes:
+#include <algorithm>
+
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 const long librandom::KnuthLFG::KK_ = 100;
 const long librandom::KnuthLFG::LL_ = 37;
 const long librandom::KnuthLFG::MM_ = 1L << 30;
@@ -134,6 +140,29 @@ librandom::KnuthLFG::ran_start_( long seed )
   next_ = end_;
 }
 
+void
+librandom::KnuthLFG::get_state( std::vector< unsigned long >& state ) const
+{
+  // generator state, buffer and position of the next number to deliver
+  state.assign( ran_x_.begin(), ran_x_.end() );
+  state.insert( state.end(), ran_buffer_.begin(), ran_buffer_.end() );
+  state.push_back( next_ - ran_buffer_.begin() );
+}
+
+void
+librandom::KnuthLFG::set_state( const std::vector< unsigned long >& state )
+{
+  if ( state.size() != static_cast< size_t >( KK_ + QUALITY_ + 1 )
+    or state.back() > static_cast< unsigned long >( KK_ ) )
+  {
+    throw UnsuitableRNG( "Invalid state for KnuthLFG." );
+  }
+  std::copy( state.begin(), state.begin() + KK_, ran_x_.begin() );
+  std::copy(
+    state.begin() + KK_, state.begin() + KK_ + QUALITY_, ran_buffer_.begin() );
+  next_ = ran_buffer_.begin() + state.back();
+}
+
 void
 librandom::KnuthLFG::self_test_()
 {
@@ -59,6 +59,9 @@ public:
     return RngPtr( new KnuthLFG( s ) );
   }
 
+  void get_state( std::vector< unsigned long >& ) const;
+  void set_state( const std::vector< unsigned long >& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
@@ -66,6 +69,9 @@ private:
   //! implements drawing a single [0,1) number for RandomGen
   double drand_();
 
+  //! implements drawing an array of [0,1) numbers for RandomGen
+  void drand_( double*, size_t );
+
 private:
   static const long KK_;          //!< the long lag
   static const long LL_;          //!< the short lag
@@ -114,6 +120,15 @@ KnuthLFG::drand_()
   return I2DFactor_ * ran_draw_();
 }
 
+inline void
+KnuthLFG::drand_( double* values, size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = I2DFactor_ * ran_draw_();
+  }
+}
+
 
 inline long
 KnuthLFG::mod_diff_( long x, long y )
@@ -25,6 +25,9 @@
 // C++ includes:
 #include <cmath>
 
+// Includes from librandom:
+#include "normal_randomdev.h"
+
 // Generated includes:
 #include "config.h"
 
@@ -100,3 +103,13 @@ double librandom::LognormalRandomDev::operator()( RngPtr r ) const
 
   return std::exp( mu_ + sigma_ * S );
 }
+
+void
+librandom::LognormalRandomDev::fill( RngPtr r, double* values, size_t n ) const
+{
+  NormalRandomDev::fill_standard_normal( r, values, n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = std::exp( mu_ + sigma_ * values[ i ] );
+  }
+}
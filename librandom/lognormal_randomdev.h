@@ -75,6 +75,8 @@ public:
   using RandomDev::operator();
   double operator()( RngPtr ) const; // threaded
 
+  void fill( RngPtr, double*, size_t ) const;
+
   //! set distribution parameters from SLI dict
   void set_status( const DictionaryDatum& );
 
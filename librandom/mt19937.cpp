@@ -57,6 +57,9 @@
 
 #include "mt19937.h"
 
+// Includes from librandom:
+#include "librandom_exceptions.h"
+
 const unsigned int librandom::MT19937::N = 624;
 const unsigned int librandom::MT19937::M = 397;
 const unsigned long librandom::MT19937::MATRIX_A = 0x9908b0dfUL;
@@ -77,6 +80,24 @@ librandom::MT19937::seed_( unsigned long s )
   init_genrand( s );
 }
 
+void
+librandom::MT19937::get_state( std::vector< unsigned long >& state ) const
+{
+  state = mt;
+  state.push_back( mti );
+}
+
+void
+librandom::MT19937::set_state( const std::vector< unsigned long >& state )
+{
+  if ( state.size() != N + 1 or state.back() > N + 1 )
+  {
+    throw UnsuitableRNG( "Invalid state for MT19937." );
+  }
+  mt.assign( state.begin(), state.end() - 1 );
+  mti = state.back();
+}
+
 void
 librandom::MT19937::init_genrand( unsigned long s )
 {
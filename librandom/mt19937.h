@@ -86,6 +86,9 @@ public:
     return RngPtr( new MT19937( s ) );
   }
 
+  void get_state( std::vector< unsigned long >& ) const;
+  void set_state( const std::vector< unsigned long >& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
@@ -93,6 +96,9 @@ private:
   //! implements drawing a single [0,1) number for RandomGen
   double drand_();
 
+  //! implements drawing an array of [0,1) numbers for RandomGen
+  void drand_( double*, size_t );
+
 private:
   // functions inherited from C-version of mt19937
 
@@ -124,6 +130,15 @@ librandom::MT19937::drand_()
   return genrand_real2();
 }
 
+inline void
+librandom::MT19937::drand_( double* values, size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = genrand_real2();
+  }
+}
+
 inline double
 librandom::MT19937::genrand_real2()
 {
@@ -23,7 +23,9 @@
 #include "normal_randomdev.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // Generated includes:
 #include "config.h"
@@ -96,3 +98,56 @@ double librandom::NormalRandomDev::operator()( RngPtr r ) const
 
   return mu_ + sigma_ * S;
 }
+
+void
+librandom::NormalRandomDev::fill( RngPtr r, double* values, size_t n ) const
+{
+  fill_standard_normal( r, values, n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = mu_ + sigma_ * values[ i ];
+  }
+}
+
+void
+librandom::NormalRandomDev::fill_standard_normal( RngPtr r,
+  double* values,
+  size_t n )
+{
+  // Box-Muller algorithm, see Knuth TAOCP, vol 2, 3rd ed, p 122
+  // Uniform numbers are drawn in blocks of at most max_block numbers,
+  // each block just large enough to produce the missing normal numbers
+  // if no pair were rejected.
+  const size_t max_block = 1024;
+  std::vector< double > uniform( std::min( max_block, n + 1 ) );
+  size_t next = 0;
+  size_t end = 0;
+
+  size_t i = 0;
+  while ( i < n )
+  {
+    if ( next == end )
+    {
+      end = std::min( max_block, 2 * ( ( n - i + 1 ) / 2 ) );
+      r->drand( &uniform[ 0 ], end );
+      next = 0;
+    }
+
+    const double V1 = 2 * uniform[ next ] - 1;
+    const double V2 = 2 * uniform[ next + 1 ] - 1;
+    next += 2;
+
+    const double S = V1 * V1 + V2 * V2;
+    if ( S >= 1 or S == 0 )
+    {
+      continue;
+    }
+
+    const double f = std::sqrt( -2 * std::log( S ) / S );
+    values[ i++ ] = V1 * f;
+    if ( i < n )
+    {
+      values[ i++ ] = V2 * f;
+    }
+  }
+}
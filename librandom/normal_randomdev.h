@@ -75,6 +75,15 @@ public:
   using RandomDev::operator();
   double operator()( RngPtr ) const; // threaded
 
+  void fill( RngPtr, double*, size_t ) const;
+
+  /**
+   * Fill array with deviates from the standard normal distribution.
+   * Uniform numbers are drawn in blocks and both numbers generated by
+   * each step of the Box-Muller algorithm are used.
+   */
+  static void fill_standard_normal( RngPtr, double*, size_t );
+
   //! set distribution parameters from SLI dict
   void set_status( const DictionaryDatum& );
 
@@ -163,6 +163,16 @@ public:
   virtual double operator()( void );             //!< single-threaded
   virtual double operator()( RngPtr ) const = 0; //!< multi-threaded
 
+  /**
+   * Fill array with n random deviates (multi-threaded).
+   *
+   * The default implementation draws each number by operator()( RngPtr ).
+   * Deviates that can generate numbers more efficiently in blocks
+   * override it. The sequence of numbers obtained need not be the same
+   * as from repeated calls to operator()( RngPtr ).
+   */
+  virtual void fill( RngPtr, double*, size_t ) const;
+
   /**
    * integer valued functions for discrete distributions
    */
@@ -217,6 +227,15 @@ inline double RandomDev::operator()( void )
   return ( *this )( rng_ );
 }
 
+inline void
+RandomDev::fill( RngPtr rthrd, double* values, size_t n ) const
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = ( *this )( rthrd );
+  }
+}
+
 inline long
 RandomDev::ldev( void )
 {
@@ -24,6 +24,7 @@
 
 // Includes from librandom:
 #include "knuthlfg.h"
+#include "librandom_exceptions.h"
 
 const unsigned long librandom::RandomGen::DefaultSeed = 0xd37ca59fUL;
 
@@ -39,3 +40,15 @@ librandom::RandomGen::create_knuthlfg_rng( unsigned long seed )
 {
   return librandom::RngPtr( new librandom::KnuthLFG( seed ) );
 }
+
+void
+librandom::RandomGen::get_state( std::vector< unsigned long >& ) const
+{
+  throw UnsuitableRNG( "This random generator cannot store its state." );
+}
+
+void
+librandom::RandomGen::set_state( const std::vector< unsigned long >& )
+{
+  throw UnsuitableRNG( "This random generator cannot restore its state." );
+}
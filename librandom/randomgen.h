@@ -253,6 +253,7 @@ public:
      random generator is provided by protected member functions below.
    */
   double drand( void );                        //!< draw from [0, 1)
+  void drand( double*, size_t );               //!< fill array from [0, 1)
   double operator()( void );                   //!< draw from [0, 1)
   double drandpos( void );                     //!< draw from (0, 1)
   unsigned long ulrand( const unsigned long ); //!< draw from [0, n-1]
@@ -273,6 +274,20 @@ public:
   //! clone a random number generator of same type initialized with given seed
   virtual RngPtr clone( const unsigned long ) = 0;
 
+  /**
+   * Store the state of the generator, so that set_state() can continue
+   * the sequence of random numbers from this point.
+   * @throws UnsuitableRNG if the generator does not support this.
+   */
+  virtual void get_state( std::vector< unsigned long >& ) const;
+
+  /**
+   * Restore a state stored by get_state() of a generator of the same type.
+   * @throws UnsuitableRNG if the generator does not support this or the
+   *         state is invalid.
+   */
+  virtual void set_state( const std::vector< unsigned long >& );
+
 protected:
   /**
      The following functions provide the interface to the actual
@@ -282,6 +297,13 @@ protected:
   virtual void seed_( unsigned long ) = 0; //!< seeding interface
   virtual double drand_() = 0;             //!< drawing interface
 
+  /**
+   * Fill array with numbers from [0, 1).
+   * The default implementation calls drand_() for each number. Generators
+   * should override it to avoid a virtual call per number.
+   */
+  virtual void drand_( double*, size_t );
+
 private:
   // prohibit copying of RNG
   RandomGen( const RandomGen& );
@@ -329,6 +351,21 @@ RandomGen::drand( void )
   return drand_();
 }
 
+inline void
+RandomGen::drand( double* values, size_t n )
+{
+  drand_( values, n );
+}
+
+inline void
+RandomGen::drand_( double* values, size_t n )
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = drand_();
+  }
+}
+
 inline double RandomGen::operator()( void )
 {
   return drand();
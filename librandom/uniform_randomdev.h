@@ -86,6 +86,8 @@ public:
   using RandomDev::operator();
   double operator()( RngPtr rthrd ) const; // threaded
 
+  void fill( RngPtr rthrd, double* values, size_t n ) const;
+
   //! set distribution parameters from SLI dict
   void set_status( const DictionaryDatum& );
 
@@ -102,5 +104,15 @@ inline double UniformRandomDev::operator()( RngPtr rthrd ) const
 {
   return low_ + delta_ * rthrd->drand();
 }
+
+inline void
+UniformRandomDev::fill( RngPtr rthrd, double* values, size_t n ) const
+{
+  rthrd->drand( values, n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = low_ + delta_ * values[ i ];
+  }
+}
 }
 #endif
@@ -23,8 +23,8 @@
 #include "correlomatrix_detector.h"
 
 // C++ includes:
-#include <cmath>      // for less
-#include <functional> // for bind2nd
+#include <algorithm>
+#include <cstdlib>
 #include <numeric>
 
 // Includes from nestkernel:
@@ -70,10 +70,8 @@ nest::correlomatrix_detector::Parameters_::Parameters_( const Parameters_& p )
 nest::correlomatrix_detector::State_::State_()
   : n_events_( 1, 0 )
   , incoming_()
-  , covariance_( 1,
-      std::vector< std::vector< double > >( 1, std::vector< double >() ) )
-  , count_covariance_( 1,
-      std::vector< std::vector< long > >( 1, std::vector< long >() ) )
+  , covariance_()
+  , count_covariance_()
 {
 }
 
@@ -93,23 +91,30 @@ nest::correlomatrix_detector::Parameters_::get( DictionaryDatum& d ) const
 }
 
 void
-nest::correlomatrix_detector::State_::get( DictionaryDatum& d ) const
+nest::correlomatrix_detector::State_::get( DictionaryDatum& d,
+  const Parameters_& p ) const
 {
   ( *d )[ names::n_events ] =
     IntVectorDatum( new std::vector< long >( n_events_ ) );
 
+  const size_t n_channels = p.N_channels_;
+  const size_t n_lags = covariance_.size() / ( n_channels * n_channels );
+
   ArrayDatum* C = new ArrayDatum;
   ArrayDatum* CountC = new ArrayDatum;
-  for ( size_t i = 0; i < covariance_.size(); ++i )
+  for ( size_t i = 0; i < n_channels; ++i )
   {
     ArrayDatum* C_i = new ArrayDatum;
     ArrayDatum* CountC_i = new ArrayDatum;
-    for ( size_t j = 0; j < covariance_[ i ].size(); ++j )
+    for ( size_t j = 0; j < n_channels; ++j )
     {
+      const size_t first = ( i * n_channels + j ) * n_lags;
       C_i->push_back( new DoubleVectorDatum(
-        new std::vector< double >( covariance_[ i ][ j ] ) ) );
+        new std::vector< double >( covariance_.begin() + first,
+          covariance_.begin() + first + n_lags ) ) );
       CountC_i->push_back( new IntVectorDatum(
-        new std::vector< long >( count_covariance_[ i ][ j ] ) ) );
+        new std::vector< long >( count_covariance_.begin() + first,
+          count_covariance_.begin() + first + n_lags ) ) );
     }
     C->push_back( *C_i );
     CountC->push_back( *CountC_i );
@@ -199,24 +204,14 @@ nest::correlomatrix_detector::State_::reset( const Parameters_& p )
 
   assert( p.tau_max_.is_multiple_of( p.delta_tau_ ) );
 
+  const size_t n_entries = p.N_channels_ * p.N_channels_
+    * ( 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps() );
+
   covariance_.clear();
-  covariance_.resize( p.N_channels_ );
+  covariance_.resize( n_entries, 0 );
 
   count_covariance_.clear();
-  count_covariance_.resize( p.N_channels_ );
-
-  for ( long i = 0; i < p.N_channels_; ++i )
-  {
-    covariance_[ i ].resize( p.N_channels_ );
-    count_covariance_[ i ].resize( p.N_channels_ );
-    for ( long j = 0; j < p.N_channels_; ++j )
-    {
-      covariance_[ i ][ j ].resize(
-        1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-      count_covariance_[ i ][ j ].resize(
-        1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-    }
-  }
+  count_covariance_.resize( n_entries, 0 );
 }
 
 /* ----------------------------------------------------------------
@@ -270,6 +265,7 @@ nest::correlomatrix_detector::init_buffers_()
 {
   device_.init_buffers();
   S_.reset( P_ );
+  B_.new_spikes_.clear();
 }
 
 void
@@ -278,6 +274,13 @@ nest::correlomatrix_detector::calibrate()
   device_.calibrate();
 }
 
+void
+nest::correlomatrix_detector::post_run_cleanup()
+{
+  // spikes from local senders may arrive after update() in the last slice
+  process_spikes_();
+}
+
 
 /* ----------------------------------------------------------------
  * Other functions
@@ -286,6 +289,7 @@ nest::correlomatrix_detector::calibrate()
 void
 nest::correlomatrix_detector::update( Time const&, const long, const long )
 {
+  process_spikes_();
 }
 
 void
@@ -304,101 +308,113 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
 
   if ( device_.is_active( stamp ) )
   {
-    const long spike_i = stamp.get_steps();
+    B_.new_spikes_.push_back( Spike_( stamp.get_steps(),
+      e.get_multiplicity() * e.get_weight(),
+      sender,
+      e.get_multiplicity() ) );
+  }
+}
+
+void
+nest::correlomatrix_detector::process_spikes_()
+{
+  if ( B_.new_spikes_.empty() )
+  {
+    return;
+  }
+
+  // spikes with equal time stamps are registered in order of arrival
+  std::stable_sort( B_.new_spikes_.begin(), B_.new_spikes_.end() );
 
-    // find first appearence of element which is greater than spike_i
-    const Spike_ sp_i( spike_i, e.get_multiplicity() * e.get_weight(), sender );
-    SpikelistType::iterator insert_pos = std::find_if( S_.incoming_.begin(),
-      S_.incoming_.end(),
-      std::bind2nd( std::greater< Spike_ >(), sp_i ) );
+  const long n_channels = P_.N_channels_;
+  const long n_lags = S_.covariance_.size() / ( n_channels * n_channels );
+  const long delta_tau = P_.delta_tau_.get_steps();
+  // time lags d with d < tau_edge fall into one of the n_lags bins
+  const long tau_edge = P_.tau_max_.get_steps() + delta_tau / 2 + 1;
+  const long min_delay = kernel().connection_manager.get_min_delay();
 
-    // insert before the position we have found
-    // if no element greater found, insert_pos == end(), so append at the end of
-    // the deque
-    S_.incoming_.insert( insert_pos, sp_i );
+  for ( std::vector< Spike_ >::const_iterator sp_i = B_.new_spikes_.begin();
+        sp_i != B_.new_spikes_.end();
+        ++sp_i )
+  {
+    const long spike_i = sp_i->timestep_;
+    const long sender = sp_i->receptor_channel_;
 
-    SpikelistType& otherSpikes = S_.incoming_;
-    const double tau_edge =
-      P_.tau_max_.get_steps() + 0.5 * P_.delta_tau_.get_steps();
+    // insert after all spikes with the same time stamp
+    S_.incoming_.insert(
+      std::upper_bound( S_.incoming_.begin(), S_.incoming_.end(), *sp_i ),
+      *sp_i );
 
     // throw away all spikes which are too old to
     // enter the correlation window
-    const delay min_delay = kernel().connection_manager.get_min_delay();
-    while ( not otherSpikes.empty()
-      && ( spike_i - otherSpikes.front().timestep_ ) >= tau_edge + min_delay )
+    while ( not S_.incoming_.empty()
+      && spike_i - S_.incoming_.front().timestep_ >= tau_edge + min_delay )
     {
-      otherSpikes.pop_front();
+      S_.incoming_.pop_front();
     }
-    // all remaining spike times in the queue are >= spike_i - tau_edge -
-    // min_delay
 
     // only count events in histogram, if the current event is within the time
-    // window [Tstart,
-    // Tstop]
+    // window [Tstart, Tstop]
     // this is needed in order to prevent boundary effects
-    if ( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ )
+    const Time stamp = Time::step( spike_i );
+    if ( not( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ ) )
     {
-      // calculate the effect of this spike immediately with respect to all
-      // spikes in the past of the respectively other sources
+      continue;
+    }
 
-      S_.n_events_[ sender ]++; // count this spike
+    S_.n_events_[ sender ]++; // count this spike
 
-      for ( SpikelistType::const_iterator spike_j = otherSpikes.begin();
-            spike_j != otherSpikes.end();
-            ++spike_j )
+    // calculate the effect of this spike with respect to all spikes in the
+    // window, starting from the most recent one; the queue contains at
+    // most spikes from one slice after spike_i
+    for ( SpikelistType::const_reverse_iterator spike_j =
+            S_.incoming_.rbegin();
+          spike_j != S_.incoming_.rend();
+          ++spike_j )
+    {
+      const long lag = spike_i - spike_j->timestep_;
+      if ( lag >= tau_edge )
       {
-        size_t bin;
-        long other = spike_j->receptor_channel_;
-        long sender_ind, other_ind;
-
-        if ( spike_i < spike_j->timestep_ )
-        {
-          sender_ind = other;
-          other_ind = sender;
-        }
-        else
-        {
-          sender_ind = sender;
-          other_ind = other;
-        }
-
-        if ( sender_ind <= other_ind )
-        {
-          bin = -1. * std::floor( ( 0.5 * P_.delta_tau_.get_steps()
-                                    - std::abs( spike_i - spike_j->timestep_ ) )
-                        / P_.delta_tau_.get_steps() );
-        }
-        else
-        {
-          bin = std::floor( ( 0.5 * P_.delta_tau_.get_steps()
-                              + std::abs( spike_i - spike_j->timestep_ ) )
-            / P_.delta_tau_.get_steps() );
-        }
-
-        if ( bin < S_.covariance_[ sender_ind ][ other_ind ].size() )
-        {
-          // weighted histogram
-          S_.covariance_[ sender_ind ][ other_ind ][ bin ] +=
-            e.get_multiplicity() * e.get_weight() * spike_j->weight_;
-          if ( bin == 0
-            && ( spike_i - spike_j->timestep_ != 0 || other != sender ) )
-          {
-            S_.covariance_[ other_ind ][ sender_ind ][ bin ] +=
-              e.get_multiplicity() * e.get_weight() * spike_j->weight_;
-          }
-          // pure (unweighted) count histogram
-          S_.count_covariance_[ sender_ind ][ other_ind ][ bin ] +=
-            e.get_multiplicity();
-          if ( bin == 0
-            && ( spike_i - spike_j->timestep_ != 0 || other != sender ) )
-          {
-            S_.count_covariance_[ other_ind ][ sender_ind ][ bin ] +=
-              e.get_multiplicity();
-          }
-        }
+        break; // all remaining spikes are older
+      }
+      if ( -lag >= tau_edge )
+      {
+        continue;
       }
 
-    } // t in [TStart, Tstop]
+      const long other = spike_j->receptor_channel_;
+
+      // the later of both spikes determines the row of the matrix
+      long sender_ind = sender;
+      long other_ind = other;
+      if ( lag < 0 )
+      {
+        sender_ind = other;
+        other_ind = sender;
+      }
+
+      // bins are centered around multiples of delta_tau; since delta_tau
+      // is odd, no lag falls on a bin border
+      const long bin = ( 2 * std::abs( lag ) + delta_tau ) / ( 2 * delta_tau );
+      assert( bin < n_lags );
+
+      const double weight = sp_i->weight_ * spike_j->weight_;
+      const size_t ij = ( sender_ind * n_channels + other_ind ) * n_lags + bin;
+
+      // weighted and pure (unweighted) count histogram
+      S_.covariance_[ ij ] += weight;
+      S_.count_covariance_[ ij ] += sp_i->multiplicity_;
+      if ( bin == 0 && ( lag != 0 || other != sender ) )
+      {
+        const size_t ji =
+          ( other_ind * n_channels + sender_ind ) * n_lags + bin;
+        S_.covariance_[ ji ] += weight;
+        S_.count_covariance_[ ji ] += sp_i->multiplicity_;
+      }
+    }
+  }
 
-  } // device active
+  // do not use swap here to clear, since we want to keep the reserved()
+  // memory for the next round
+  B_.new_spikes_.clear();
 }
@@ -137,14 +137,13 @@ namespace nest
  *       follows: the internal buffers for storing spikes are part
  *       of State_, but are initialized by init_buffers_().
  *
- * @todo The correlation detector could be made more efficient as follows
- *       (HEP 2008-07-01):
- *       - incoming_ is vector of two deques
- *       - let handle() push_back() entries in incoming_ and do nothing else
- *       - keep index to last "old spike" in each incoming_; cannot
- *         be iterator since that may change
- *       - update() deletes all entries before now-tau_max, sorts the new
- *         entries, then registers new entries in histogram
+ * handle() only appends incoming spikes to a buffer. update() sorts the
+ * spikes received during the time slice and registers them in the
+ * histograms in one sweep, visiting for each spike only the spikes in
+ * the history that lie within the correlation window. Since delta_tau
+ * is an odd multiple of the resolution, the bin of a time lag can be
+ * computed in integer arithmetic. The histograms are stored contiguously
+ * with the time lag as fastest running index.
  */
 
 class correlomatrix_detector : public Node
@@ -183,9 +182,15 @@ private:
   void init_state_( Node const& );
   void init_buffers_();
   void calibrate();
+  void post_run_cleanup();
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Register all buffered spikes in the histograms.
+   */
+  void process_spikes_();
+
   // ------------------------------------------------------------
 
   /**
@@ -197,20 +202,25 @@ private:
     long timestep_;
     double weight_;
     long receptor_channel_;
+    long multiplicity_;
 
-    Spike_( long timestep, double weight, long receptorchannel )
+    Spike_( long timestep,
+      double weight,
+      long receptorchannel,
+      long multiplicity )
       : timestep_( timestep )
       , weight_( weight )
       , receptor_channel_( receptorchannel )
+      , multiplicity_( multiplicity )
     {
     }
 
     /**
-     * Greater operator needed for insertion sort.
+     * Less operator needed for sorting by time stamp.
      */
-    inline bool operator>( const Spike_& second ) const
+    inline bool operator<( const Spike_& second ) const
     {
-      return timestep_ > second.timestep_;
+      return timestep_ < second.timestep_;
     }
   };
 
@@ -245,9 +255,6 @@ private:
   // ------------------------------------------------------------
 
   /**
-   * @todo Is there a replacement for std::list that allows fast
-   *       insertion inside, fast deletion at the beginning, and
-   *       maintains sorting?
    * @note Constructed with empty structures, which are set to
    *       proper sizes by init_buffers_().
    * @note State_ only contains read-out values, so we copy-construct
@@ -257,19 +264,21 @@ private:
   {
 
     std::vector< long > n_events_; //!< spike counters
-    SpikelistType incoming_;       //!< incoming spikes, sorted
-                                   /** Weighted covariance matrix.
-                                    *  @note Data type is double to accomodate weights.
-                                    */
-    std::vector< std::vector< std::vector< double > > > covariance_;
+    SpikelistType incoming_;       //!< spikes in correlation window, sorted
+
+    /** Weighted covariance matrix, entry (i, j, bin) is stored at
+     *  ( i * N_channels + j ) * n_lags + bin.
+     *  @note Data type is double to accomodate weights.
+     */
+    std::vector< double > covariance_;
 
-    /** Unweighted covariance matrix.
+    /** Unweighted covariance matrix, same layout as covariance_.
      */
-    std::vector< std::vector< std::vector< long > > > count_covariance_;
+    std::vector< long > count_covariance_;
 
     State_(); //!< initialize default state
 
-    void get( DictionaryDatum& ) const;
+    void get( DictionaryDatum&, const Parameters_& ) const;
 
     /**
      * @param bool if true, force state reset
@@ -281,9 +290,17 @@ private:
 
   // ------------------------------------------------------------
 
+  struct Buffers_
+  {
+    std::vector< Spike_ > new_spikes_; //!< spikes received in this slice
+  };
+
+  // ------------------------------------------------------------
+
   PseudoRecordingDevice device_;
   Parameters_ P_;
   State_ S_;
+  Buffers_ B_;
 };
 
 inline port
@@ -301,7 +318,7 @@ nest::correlomatrix_detector::get_status( DictionaryDatum& d ) const
 {
   device_.get_status( d );
   P_.get( d );
-  S_.get( d );
+  S_.get( d, P_ );
 
   ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
 }
@@ -30,6 +30,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -421,4 +422,24 @@ iaf_psc_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+void
+iaf_psc_alpha::save_state( CheckpointWriter& writer ) const
+{
+  writer.write( S_ );
+  B_.ex_spikes_.save( writer );
+  B_.in_spikes_.save( writer );
+  B_.currents_.save( writer );
+  save_history_( writer );
+}
+
+void
+iaf_psc_alpha::restore_state( CheckpointReader& reader )
+{
+  reader.read( S_ );
+  B_.ex_spikes_.restore( reader );
+  B_.in_spikes_.restore( reader );
+  B_.currents_.restore( reader );
+  restore_history_( reader );
+}
+
 } // namespace
@@ -157,6 +157,9 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void save_state( CheckpointWriter& ) const;
+  void restore_state( CheckpointReader& );
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
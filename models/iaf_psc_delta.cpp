@@ -31,6 +31,7 @@
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -380,4 +381,22 @@ nest::iaf_psc_delta::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+void
+nest::iaf_psc_delta::save_state( CheckpointWriter& writer ) const
+{
+  writer.write( S_ );
+  B_.spikes_.save( writer );
+  B_.currents_.save( writer );
+  save_history_( writer );
+}
+
+void
+nest::iaf_psc_delta::restore_state( CheckpointReader& reader )
+{
+  reader.read( S_ );
+  B_.spikes_.restore( reader );
+  B_.currents_.restore( reader );
+  restore_history_( reader );
+}
+
 } // namespace
@@ -30,6 +30,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -396,3 +397,26 @@ nest::iaf_psc_exp::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
+
+void
+nest::iaf_psc_exp::save_state( CheckpointWriter& writer ) const
+{
+  writer.write( S_ );
+  B_.spikes_ex_.save( writer );
+  B_.spikes_in_.save( writer );
+  B_.currents_[ 0 ].save( writer );
+  B_.currents_[ 1 ].save( writer );
+  save_history_( writer );
+}
+
+void
+nest::iaf_psc_exp::restore_state( CheckpointReader& reader )
+{
+  reader.read( S_ );
+  B_.currents_.resize( 2 );
+  B_.spikes_ex_.restore( reader );
+  B_.spikes_in_.restore( reader );
+  B_.currents_[ 0 ].restore( reader );
+  B_.currents_[ 1 ].restore( reader );
+  restore_history_( reader );
+}
@@ -104,6 +104,7 @@
 #include "correlospinmatrix_detector.h"
 #include "multimeter.h"
 #include "spike_detector.h"
+#include "spike_statistics_detector.h"
 #include "spin_detector.h"
 #include "weight_recorder.h"
 
@@ -250,6 +251,8 @@ ModelsModule::init( SLIInterpreter* )
 
   kernel().model_manager.register_node_model< spike_detector >(
     "spike_detector" );
+  kernel().model_manager.register_node_model< spike_statistics_detector >(
+    "spike_statistics_detector" );
   kernel().model_manager.register_node_model< weight_recorder >(
     "weight_recorder" );
   kernel().model_manager.register_node_model< spin_detector >(
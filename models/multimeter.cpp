@@ -231,12 +231,20 @@ Multimeter::handle( DataLoggingReply& reply )
 {
   // easy access to relevant information
   DataLoggingReply::Container const& info = reply.get_info();
+  const size_t n_vars = info.num_vars;
+
+  // one column per recorded quantity; columns are removed if data is cleared
+  if ( S_.data_.size() != n_vars )
+  {
+    assert( S_.num_rows() == 0 );
+    S_.data_.resize( n_vars );
+  }
 
   // If this is the first Reply arriving, we need to mark the beginning of the
   // data for this round of replies
   if ( V_.new_request_ )
   {
-    V_.current_request_data_start_ = S_.data_.size();
+    V_.current_request_data_start_ = S_.num_rows();
   }
 
   // count records that have been skipped during inactivity
@@ -245,19 +253,21 @@ Multimeter::handle( DataLoggingReply& reply )
   // record all data, time point by time point
   for ( size_t j = 0; j < info.size(); ++j )
   {
-    if ( not info[ j ].timestamp.is_finite() )
+    if ( not info.timestamps[ j ].is_finite() )
     {
       break;
     }
 
-    if ( not is_active( info[ j ].timestamp ) )
+    if ( not is_active( info.timestamps[ j ] ) )
     {
       ++inactive_skipped;
       continue;
     }
 
+    const double* const values = info.row( j );
+
     // store stamp for current data set in event for logging
-    reply.set_stamp( info[ j ].timestamp );
+    reply.set_stamp( info.timestamps[ j ] );
 
     // record sender and time information; in accumulator mode only for first
     // Reply in slice
@@ -269,11 +279,14 @@ Multimeter::handle( DataLoggingReply& reply )
     if ( not device_.to_accumulator() )
     {
       // "print" actual data, but not in accumulator mode
-      print_value_( info[ j ].data );
+      print_value_( values, n_vars );
 
       if ( device_.to_memory() )
       {
-        S_.data_.push_back( info[ j ].data );
+        for ( size_t k = 0; k < n_vars; ++k )
+        {
+          S_.data_[ k ].push_back( values[ k ] );
+        }
       }
     }
     else
@@ -281,21 +294,22 @@ Multimeter::handle( DataLoggingReply& reply )
       if ( V_.new_request_ ) // first reply in slice, push back to create new
                              // time points
       {
-        S_.data_.push_back( info[ j ].data );
+        for ( size_t k = 0; k < n_vars; ++k )
+        {
+          S_.data_[ k ].push_back( values[ k ] );
+        }
       }
       else
       { // add data; offset j from current_request_data_start_, but inactive
         // skipped entries subtracted
         assert( j >= inactive_skipped );
-        assert( V_.current_request_data_start_ + j - inactive_skipped
-          < S_.data_.size() );
-        assert( S_.data_[ V_.current_request_data_start_ + j
-                     - inactive_skipped ].size() == info[ j ].data.size() );
+        const size_t row =
+          V_.current_request_data_start_ + j - inactive_skipped;
+        assert( row < S_.num_rows() );
 
-        for ( size_t k = 0; k < info[ j ].data.size(); ++k )
+        for ( size_t k = 0; k < n_vars; ++k )
         {
-          S_.data_[ V_.current_request_data_start_ + j
-            - inactive_skipped ][ k ] += info[ j ].data[ k ];
+          S_.data_[ k ][ row ] += values[ k ];
         }
       }
     }
@@ -306,42 +320,41 @@ Multimeter::handle( DataLoggingReply& reply )
 }
 
 void
-Multimeter::print_value_( const std::vector< double >& values )
+Multimeter::print_value_( const double* values, size_t n_values )
 {
-  if ( values.size() < 1 )
+  if ( n_values < 1 )
   {
     return;
   }
 
-  for ( size_t j = 0; j < values.size() - 1; ++j )
+  for ( size_t j = 0; j < n_values - 1; ++j )
   {
     device_.print_value( values[ j ], false );
   }
 
-  device_.print_value( values[ values.size() - 1 ] );
+  device_.print_value( values[ n_values - 1 ] );
 }
 
 
 void
 Multimeter::add_data_( DictionaryDatum& d ) const
 {
-  // re-organize data into one vector per recorded variable
+  // data is already organized in one vector per recorded variable
   for ( size_t v = 0; v < P_.record_from_.size(); ++v )
   {
-    std::vector< double > dv( S_.data_.size() );
-    for ( size_t t = 0; t < S_.data_.size(); ++t )
+    initialize_property_doublevector( d, P_.record_from_[ v ] );
+    if ( v >= S_.data_.size() )
     {
-      assert( v < S_.data_[ t ].size() );
-      dv[ t ] = S_.data_[ t ][ v ];
+      continue; // nothing recorded yet
     }
-    initialize_property_doublevector( d, P_.record_from_[ v ] );
-    if ( device_.to_accumulator() && not dv.empty() )
+
+    if ( device_.to_accumulator() && not S_.data_[ v ].empty() )
     {
-      accumulate_property( d, P_.record_from_[ v ], dv );
+      accumulate_property( d, P_.record_from_[ v ], S_.data_[ v ] );
     }
     else
     {
-      append_property( d, P_.record_from_[ v ], dv );
+      append_property( d, P_.record_from_[ v ], S_.data_[ v ] );
     }
   }
 }
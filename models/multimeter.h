@@ -220,7 +220,7 @@ private:
    *       RecordingDevice::print_value() can handle. Otherwise, specialization
    *       is required.
    */
-  void print_value_( const std::vector< double >& );
+  void print_value_( const double* values, size_t n_values );
 
   /**
    * Add recorded data to dictionary.
@@ -255,16 +255,20 @@ private:
   struct State_
   {
     /** Recorded data.
-     * First dimension: time
-     * Second dimension: recorded variables
-     * @note In normal mode, data is stored as follows:
+     * First dimension: recorded variables
+     * Second dimension: time
+     * @note Data is stored in columns, one per recorded quantity, so that
+     *       storing a data point does not require allocating memory.
+     *       In normal mode, data is stored as follows:
      *          For each recorded node, all data points for one time slice are
-     *          put after one another in the first dimension. Each entry is a
-     *          vector containing one element per recorded quantity.
+     *          put after one another in each column.
      *       In accumulating mode, only one data point is stored per time step
      *          and values are added across nodes.
      */
     std::vector< std::vector< double > > data_; //!< Recorded data
+
+    //! Number of data points stored, i.e., length of each column
+    size_t num_rows() const;
   };
 
   // ------------------------------------------------------------
@@ -310,6 +314,12 @@ private:
 };
 
 
+inline size_t
+nest::Multimeter::State_::num_rows() const
+{
+  return data_.empty() ? 0 : data_[ 0 ].size();
+}
+
 inline void
 nest::Multimeter::get_status( DictionaryDatum& d ) const
 {
@@ -30,6 +30,7 @@
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -107,4 +108,18 @@ parrot_neuron::handle( SpikeEvent& e )
   }
 }
 
+void
+parrot_neuron::save_state( CheckpointWriter& writer ) const
+{
+  B_.n_spikes_.save( writer );
+  save_history_( writer );
+}
+
+void
+parrot_neuron::restore_state( CheckpointReader& reader )
+{
+  B_.n_spikes_.restore( reader );
+  restore_history_( reader );
+}
+
 } // namespace
@@ -182,6 +182,18 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  //! The dynamic state is not stored in checkpoints.
+  void
+  save_state( CheckpointWriter& ) const
+  {
+    checkpoint_not_supported_();
+  }
+  void
+  restore_state( CheckpointReader& )
+  {
+    checkpoint_not_supported_();
+  }
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -0,0 +1,599 @@
+/*
+ *  spike_statistics_detector.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_statistics_detector.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "sibling_container.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dict.h"
+#include "dictutils.h"
+
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_detector::NeuronStats_::NeuronStats_()
+  : n_spikes_( 0 )
+  , last_stamp_( 0 )
+  , last_offset_( 0.0 )
+  , n_isi_( 0 )
+  , isi_sum_( 0.0 )
+  , isi_sum_sq_( 0.0 )
+{
+}
+
+nest::spike_statistics_detector::Parameters_::Parameters_()
+  : bin_width_( Time::ms( 1.0 ) )
+  , isi_bin_width_( Time::ms( 1.0 ) )
+  , isi_max_( Time::ms( 100.0 ) )
+{
+}
+
+nest::spike_statistics_detector::Parameters_::Parameters_(
+  const Parameters_& p )
+  : bin_width_( p.bin_width_ )
+  , isi_bin_width_( p.isi_bin_width_ )
+  , isi_max_( p.isi_max_ )
+{
+  // Check for proper properties is not done here but in the
+  // spike_statistics_detector() copy c'tor, see correlation_detector.
+  bin_width_.calibrate();
+  isi_bin_width_.calibrate();
+  isi_max_.calibrate();
+}
+
+nest::spike_statistics_detector::State_::State_()
+  : n_events_( 0 )
+  , neurons_()
+  , population_counts_()
+  , isi_histogram_()
+{
+}
+
+nest::spike_statistics_detector::Results_::Results_()
+  : n_events_( 0 )
+  , population_counts_()
+  , isi_histogram_()
+  , senders_()
+  , spike_counts_()
+  , rates_()
+  , cvs_()
+  , mean_rate_( 0.0 )
+  , mean_cv_( 0.0 )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_detector::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::bin_width ] = bin_width_.get_ms();
+  ( *d )[ names::isi_bin_width ] = isi_bin_width_.get_ms();
+  ( *d )[ names::isi_max ] = isi_max_.get_ms();
+}
+
+void
+nest::spike_statistics_detector::Results_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::n_events ] = n_events_;
+  ( *d )[ names::population_counts ] =
+    IntVectorDatum( new std::vector< long >( population_counts_ ) );
+  ( *d )[ names::isi_histogram ] =
+    IntVectorDatum( new std::vector< long >( isi_histogram_ ) );
+  ( *d )[ names::senders ] =
+    IntVectorDatum( new std::vector< long >( senders_ ) );
+  ( *d )[ names::spike_counts ] =
+    IntVectorDatum( new std::vector< long >( spike_counts_ ) );
+  ( *d )[ names::rates ] =
+    DoubleVectorDatum( new std::vector< double >( rates_ ) );
+  ( *d )[ names::cvs ] = DoubleVectorDatum( new std::vector< double >( cvs_ ) );
+  ( *d )[ names::mean_rate ] = mean_rate_;
+  ( *d )[ names::mean_cv ] = mean_cv_;
+}
+
+bool
+nest::spike_statistics_detector::Parameters_::set( const DictionaryDatum& d,
+  const spike_statistics_detector& n )
+{
+  bool reset = false;
+  double t;
+  if ( updateValue< double >( d, names::bin_width, t ) )
+  {
+    bin_width_ = Time::ms( t );
+    reset = true;
+  }
+
+  if ( updateValue< double >( d, names::isi_bin_width, t ) )
+  {
+    isi_bin_width_ = Time::ms( t );
+    reset = true;
+  }
+
+  if ( updateValue< double >( d, names::isi_max, t ) )
+  {
+    isi_max_ = Time::ms( t );
+    reset = true;
+  }
+
+  if ( not bin_width_.is_step() )
+  {
+    throw StepMultipleRequired( n.get_name(), names::bin_width, bin_width_ );
+  }
+
+  if ( not isi_bin_width_.is_step() )
+  {
+    throw StepMultipleRequired(
+      n.get_name(), names::isi_bin_width, isi_bin_width_ );
+  }
+
+  if ( bin_width_.get_steps() <= 0 or isi_bin_width_.get_steps() <= 0 )
+  {
+    throw BadProperty( "Bin widths must be positive." );
+  }
+
+  if ( isi_max_.get_steps() < 0
+    or not isi_max_.is_multiple_of( isi_bin_width_ ) )
+  {
+    throw TimeMultipleRequired( n.get_name(),
+      names::isi_max,
+      isi_max_,
+      names::isi_bin_width,
+      isi_bin_width_ );
+  }
+
+  return reset;
+}
+
+bool
+nest::spike_statistics_detector::State_::set( const DictionaryDatum& d,
+  const Parameters_& p,
+  bool reset_required )
+{
+  long nev;
+  if ( updateValue< long >( d, names::n_events, nev ) )
+  {
+    if ( nev == 0 )
+    {
+      reset_required = true;
+    }
+    else
+    {
+      throw BadProperty( "n_events can only be set to 0." );
+    }
+  }
+  if ( reset_required )
+  {
+    reset( p );
+  }
+  return reset_required;
+}
+
+void
+nest::spike_statistics_detector::State_::reset( const Parameters_& p )
+{
+  n_events_ = 0;
+  neurons_.clear();
+  population_counts_.clear();
+
+  assert( p.isi_max_.is_multiple_of( p.isi_bin_width_ ) );
+  isi_histogram_.clear();
+  isi_histogram_.resize(
+    p.isi_max_.get_steps() / p.isi_bin_width_.get_steps(), 0 );
+}
+
+void
+nest::spike_statistics_detector::Results_::clear()
+{
+  n_events_ = 0;
+  population_counts_.clear();
+  isi_histogram_.clear();
+  senders_.clear();
+  spike_counts_.clear();
+  rates_.clear();
+  cvs_.clear();
+  mean_rate_ = 0.0;
+  mean_cv_ = 0.0;
+}
+
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for node
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_detector::spike_statistics_detector()
+  : Node()
+  , device_()
+  , P_()
+  , S_()
+  , R_()
+{
+  if ( not P_.bin_width_.is_step() )
+  {
+    throw InvalidDefaultResolution(
+      get_name(), names::bin_width, P_.bin_width_ );
+  }
+  if ( not P_.isi_bin_width_.is_step() )
+  {
+    throw InvalidDefaultResolution(
+      get_name(), names::isi_bin_width, P_.isi_bin_width_ );
+  }
+}
+
+nest::spike_statistics_detector::spike_statistics_detector(
+  const spike_statistics_detector& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_()
+  , R_()
+{
+  if ( not P_.bin_width_.is_step() )
+  {
+    throw InvalidTimeInModel( get_name(), names::bin_width, P_.bin_width_ );
+  }
+  if ( not P_.isi_bin_width_.is_step() )
+  {
+    throw InvalidTimeInModel(
+      get_name(), names::isi_bin_width, P_.isi_bin_width_ );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_detector::init_state_( const Node& proto )
+{
+  const spike_statistics_detector& pr =
+    downcast< spike_statistics_detector >( proto );
+
+  device_.init_state( pr.device_ );
+  S_ = pr.S_;
+  set_buffers_initialized( false ); // force recreation of buffers
+}
+
+void
+nest::spike_statistics_detector::init_buffers_()
+{
+  device_.init_buffers();
+  S_.reset( P_ );
+  R_.clear();
+
+  std::vector< std::vector< Spike_ > > tmp( 2, std::vector< Spike_ >() );
+  B_.spikes_.swap( tmp );
+
+  B_.n_connected_ = 0;
+  B_.n_connections_ = 0;
+  B_.connected_valid_ = false;
+}
+
+void
+nest::spike_statistics_detector::calibrate()
+{
+  device_.calibrate();
+}
+
+
+/* ----------------------------------------------------------------
+ * Other functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_detector::update( Time const&, const long, const long )
+{
+  std::vector< Spike_ >& spikes =
+    B_.spikes_[ kernel().event_delivery_manager.read_toggle() ];
+
+  // intervals require the spikes of each sender in chronological order
+  std::sort( spikes.begin(), spikes.end() );
+  for ( std::vector< Spike_ >::const_iterator s = spikes.begin();
+        s != spikes.end();
+        ++s )
+  {
+    record_spike_( *s );
+  }
+
+  // do not use swap here to clear, since we want to keep the reserved()
+  // memory for the next round
+  spikes.clear();
+}
+
+void
+nest::spike_statistics_detector::record_spike_( const Spike_& s )
+{
+  ++S_.n_events_;
+
+  // spikes are recorded if t_min < stamp <= t_max
+  const size_t bin =
+    ( s.stamp_ - device_.get_t_min_() - 1 ) / P_.bin_width_.get_steps();
+  if ( bin >= S_.population_counts_.size() )
+  {
+    S_.population_counts_.resize( bin + 1, 0 );
+  }
+  ++S_.population_counts_[ bin ];
+
+  NeuronStats_& n = S_.neurons_[ s.sender_ ];
+  if ( n.n_spikes_ > 0 )
+  {
+    // interval in steps, computed from differences to avoid rounding
+    // errors for spikes on the grid
+    const double isi_steps = ( s.stamp_ - n.last_stamp_ )
+      - ( s.offset_ - n.last_offset_ ) / Time::get_resolution().get_ms();
+    const double isi = isi_steps * Time::get_resolution().get_ms();
+
+    ++n.n_isi_;
+    n.isi_sum_ += isi;
+    n.isi_sum_sq_ += isi * isi;
+
+    const size_t isi_bin = static_cast< size_t >(
+      std::floor( isi_steps / P_.isi_bin_width_.get_steps() ) );
+    if ( isi_bin < S_.isi_histogram_.size() )
+    {
+      ++S_.isi_histogram_[ isi_bin ];
+    }
+  }
+  ++n.n_spikes_;
+  n.last_stamp_ = s.stamp_;
+  n.last_offset_ = s.offset_;
+}
+
+void
+nest::spike_statistics_detector::post_run_collect()
+{
+  // sum the statistics of all thread siblings
+  long n_events = 0;
+  std::vector< long > population_counts;
+  std::vector< long > isi_histogram( S_.isi_histogram_.size(), 0 );
+  NeuronStatsMap neurons;
+
+  const SiblingContainer* siblings =
+    kernel().node_manager.get_thread_siblings( get_gid() );
+  for ( std::vector< Node* >::const_iterator sibling = siblings->begin();
+        sibling != siblings->end();
+        ++sibling )
+  {
+    const State_& s = downcast< spike_statistics_detector >( **sibling ).S_;
+
+    n_events += s.n_events_;
+    if ( s.population_counts_.size() > population_counts.size() )
+    {
+      population_counts.resize( s.population_counts_.size(), 0 );
+    }
+    for ( size_t i = 0; i < s.population_counts_.size(); ++i )
+    {
+      population_counts[ i ] += s.population_counts_[ i ];
+    }
+    for ( size_t i = 0; i < s.isi_histogram_.size(); ++i )
+    {
+      isi_histogram[ i ] += s.isi_histogram_[ i ];
+    }
+    for ( NeuronStatsMap::const_iterator it = s.neurons_.begin();
+          it != s.neurons_.end();
+          ++it )
+    {
+      NeuronStats_& n = neurons[ it->first ];
+      n.n_spikes_ += it->second.n_spikes_;
+      n.n_isi_ += it->second.n_isi_;
+      n.isi_sum_ += it->second.isi_sum_;
+      n.isi_sum_sq_ += it->second.isi_sum_sq_;
+    }
+  }
+
+  // sum histograms across processes in a single reduction; the number of
+  // population bins depends on the last local spike and may differ
+  std::vector< long > n_bins( kernel().mpi_manager.get_num_processes(), 0 );
+  n_bins[ kernel().mpi_manager.get_rank() ] = population_counts.size();
+  kernel().mpi_manager.communicate( n_bins );
+  const size_t max_bins = *std::max_element( n_bins.begin(), n_bins.end() );
+  population_counts.resize( max_bins, 0 );
+
+  std::vector< double > sums( 1, n_events );
+  sums.insert( sums.end(), population_counts.begin(), population_counts.end() );
+  sums.insert( sums.end(), isi_histogram.begin(), isi_histogram.end() );
+  kernel().mpi_manager.communicate_Allreduce_sum_in_place( sums );
+
+  R_.n_events_ = static_cast< long >( sums[ 0 ] );
+  R_.population_counts_.assign( sums.begin() + 1, sums.begin() + 1 + max_bins );
+  R_.isi_histogram_.assign( sums.begin() + 1 + max_bins, sums.end() );
+
+  // gather the statistics of all senders, which are local to one process
+  const size_t n_fields = 5;
+  std::vector< double > local_stats;
+  local_stats.reserve( n_fields * neurons.size() );
+  for ( NeuronStatsMap::const_iterator it = neurons.begin();
+        it != neurons.end();
+        ++it )
+  {
+    local_stats.push_back( it->first );
+    local_stats.push_back( it->second.n_spikes_ );
+    local_stats.push_back( it->second.n_isi_ );
+    local_stats.push_back( it->second.isi_sum_ );
+    local_stats.push_back( it->second.isi_sum_sq_ );
+  }
+
+  std::vector< double > global_stats;
+  std::vector< int > displacements;
+  kernel().mpi_manager.communicate( local_stats, global_stats, displacements );
+
+  neurons.clear();
+  for ( size_t i = 0; i + n_fields <= global_stats.size(); i += n_fields )
+  {
+    NeuronStats_& n = neurons[ static_cast< index >( global_stats[ i ] ) ];
+    n.n_spikes_ += static_cast< long >( global_stats[ i + 1 ] );
+    n.n_isi_ += static_cast< long >( global_stats[ i + 2 ] );
+    n.isi_sum_ += global_stats[ i + 3 ];
+    n.isi_sum_sq_ += global_stats[ i + 4 ];
+  }
+
+  // the mean rate refers to all connected senders, including those that
+  // have not fired; senders replicated on all processes are counted once.
+  // The senders are searched for only after connections have changed on
+  // some process, which all processes must agree on for the gather.
+  const size_t n_connections =
+    kernel().connection_manager.get_num_connections();
+  if ( kernel().mpi_manager.any_true(
+         not B_.connected_valid_ or n_connections != B_.n_connections_ ) )
+  {
+    DictionaryDatum params( new Dictionary );
+    def< std::vector< long > >(
+      params, names::target, std::vector< long >( 1, get_gid() ) );
+    ConnectionArrays conns;
+    kernel().connection_manager.get_connections( conns, params );
+    std::vector< double > local_senders(
+      conns.source_gid_.begin(), conns.source_gid_.end() );
+    std::vector< double > connected;
+    kernel().mpi_manager.communicate(
+      local_senders, connected, displacements );
+    std::sort( connected.begin(), connected.end() );
+    B_.n_connected_ =
+      std::unique( connected.begin(), connected.end() ) - connected.begin();
+    B_.n_connections_ = n_connections;
+    B_.connected_valid_ = true;
+  }
+  const size_t n_connected = B_.n_connected_;
+
+  // duration of recording, limited by the end of the last Run
+  const long t_end = std::min(
+    kernel().simulation_manager.get_time().get_steps(), device_.get_t_max_() );
+  const double duration_s = Time( Time::step( std::max(
+                                    t_end - device_.get_t_min_(), 0L ) ) )
+                              .get_ms() / 1000.0;
+
+  R_.senders_.clear();
+  R_.spike_counts_.clear();
+  R_.rates_.clear();
+  R_.cvs_.clear();
+  R_.mean_rate_ = 0.0;
+  R_.mean_cv_ = 0.0;
+
+  size_t n_cvs = 0;
+  for ( NeuronStatsMap::const_iterator it = neurons.begin();
+        it != neurons.end();
+        ++it )
+  {
+    const NeuronStats_& n = it->second;
+    const double rate = duration_s > 0 ? n.n_spikes_ / duration_s : 0.0;
+
+    double cv = 0.0;
+    if ( n.n_isi_ > 1 )
+    {
+      const double mean = n.isi_sum_ / n.n_isi_;
+      const double var =
+        std::max( n.isi_sum_sq_ / n.n_isi_ - mean * mean, 0.0 );
+      cv = mean > 0 ? std::sqrt( var ) / mean : 0.0;
+      R_.mean_cv_ += cv;
+      ++n_cvs;
+    }
+
+    R_.senders_.push_back( it->first );
+    R_.spike_counts_.push_back( n.n_spikes_ );
+    R_.rates_.push_back( rate );
+    R_.cvs_.push_back( cv );
+    R_.mean_rate_ += rate;
+  }
+
+  // senders that have fired, but are no longer connected, count as well
+  const size_t n_senders = std::max( n_connected, neurons.size() );
+  if ( n_senders > 0 )
+  {
+    R_.mean_rate_ /= n_senders;
+  }
+  if ( n_cvs > 0 )
+  {
+    R_.mean_cv_ /= n_cvs;
+  }
+}
+
+void
+nest::spike_statistics_detector::get_status( DictionaryDatum& d ) const
+{
+  device_.get_status( d );
+  P_.get( d );
+  R_.get( d );
+
+  ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
+}
+
+void
+nest::spike_statistics_detector::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_;
+  const bool reset_required = ptmp.set( d, *this );
+  State_ stmp;
+  const bool reset = stmp.set( d, ptmp, reset_required );
+
+  device_.set_status( d );
+  P_ = ptmp;
+  if ( reset )
+  {
+    S_ = stmp;
+    R_.clear();
+  }
+}
+
+void
+nest::spike_statistics_detector::handle( SpikeEvent& e )
+{
+  // accept spikes only if detector was active when spike was
+  // emitted
+  if ( device_.is_active( e.get_stamp() ) )
+  {
+    assert( e.get_multiplicity() > 0 );
+
+    long dest_buffer;
+    if ( kernel()
+           .modelrange_manager.get_model_of_gid( e.get_sender_gid() )
+           ->has_proxies() )
+    {
+      // events from central queue
+      dest_buffer = kernel().event_delivery_manager.read_toggle();
+    }
+    else
+    {
+      // locally delivered events
+      dest_buffer = kernel().event_delivery_manager.write_toggle();
+    }
+
+    const Spike_ spike(
+      e.get_sender_gid(), e.get_stamp().get_steps(), e.get_offset() );
+    for ( int i = 0; i < e.get_multiplicity(); ++i )
+    {
+      B_.spikes_[ dest_buffer ].push_back( spike );
+    }
+  }
+}
@@ -0,0 +1,338 @@
+/*
+ *  spike_statistics_detector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_STATISTICS_DETECTOR_H
+#define SPIKE_STATISTICS_DETECTOR_H
+
+
+// C++ includes:
+#include <map>
+#include <vector>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+#include "nest_types.h"
+#include "node.h"
+#include "pseudo_recording_device.h"
+
+/* BeginDocumentation
+
+Name: spike_statistics_detector - Device for recording population spike
+                                  statistics without storing spikes.
+
+Description:
+The spike_statistics_detector is connected like a spike_detector, but
+instead of storing every spike, it accumulates statistics of the spike
+trains of all connected neurons while the simulation runs:
+
+- the number of spikes of the population in bins of width bin_width,
+- the number of spikes, the firing rate and the coefficient of variation
+  (CV) of the inter-spike intervals of each sender,
+- a histogram of the inter-spike intervals of all senders in bins of
+  width isi_bin_width, covering intervals up to isi_max.
+
+Spikes are buffered only for one min_delay period. At the end of each
+call to Run, the statistics collected on all threads and MPI processes
+are combined, so that GetStatus returns the statistics of the entire
+population on every process.
+
+Population bin i counts the spikes with times t in
+
+  ( start + origin + i*bin_width, start + origin + (i+1)*bin_width ]
+
+Rates are given in spikes/s and refer to the time from start + origin
+to the end of the last Run or to stop + origin, whichever is earlier.
+Only neurons that have fired at least once are listed in senders;
+mean_rate averages over all connected neurons, including those that have
+not fired. The CV is reported as 0 for
+senders with fewer than two inter-spike intervals and mean_cv averages
+over the remaining senders. Intervals longer than isi_max are included
+in the CV, but not in the histogram.
+
+As for the spike_detector, spikes emitted during the last min_delay
+period before the end of a simulation are not recorded.
+
+Parameters:
+bin_width          double       - Width of population count bins in ms,
+                                  must be a multiple of the resolution
+isi_bin_width      double       - Width of ISI histogram bins in ms,
+                                  must be a multiple of the resolution
+isi_max            double       - Largest ISI included in the histogram,
+                                  must be a multiple of isi_bin_width
+n_events           integer      - Number of recorded spikes, setting it
+                                  to 0 clears all statistics.
+population_counts  long vector  - Spike count of all senders per bin
+isi_histogram      long vector  - Histogram of inter-spike intervals
+senders            long vector  - GIDs of all senders that have fired
+spike_counts       long vector  - Number of spikes of each sender
+rates              double vector - Firing rate of each sender in spikes/s
+cvs                double vector - CV of the ISIs of each sender
+mean_rate          double       - Mean firing rate of all connected
+                                  neurons
+mean_cv            double       - Mean CV of all senders
+
+Changing one of the bin widths or isi_max clears all statistics.
+
+Example:
+/iaf_psc_alpha 100 << /I_e 400.0 >> Create
+/spike_statistics_detector << /bin_width 10.0 >> Create /ssd Set
+1 1 100 range { ssd Connect } forall
+1000 Simulate
+ssd [/mean_rate] get ==
+
+Receives: SpikeEvent
+
+Author: Core team
+FirstVersion: October 2026
+SeeAlso: spike_detector, correlation_detector, Device, PseudoRecordingDevice
+*/
+
+
+namespace nest
+{
+/**
+ * Spike statistics detector class.
+ *
+ * The device is replicated on all virtual processes and receives the
+ * spikes of local neurons like the spike_detector. Spikes are buffered
+ * in a two-segment buffer as in the spike_detector and folded into the
+ * statistics of the thread sibling in update(). Since all spikes of a
+ * neuron arrive at the same sibling, interval statistics per neuron are
+ * exact.
+ *
+ * The statistics of all siblings are combined by post_run_collect() on
+ * thread 0, which sums histograms with an MPI reduction and gathers the
+ * per-neuron statistics from all processes. The combined results are
+ * stored in the sibling on thread 0, from which GetStatus reads. The
+ * number of connected senders needed for the mean rate is cached there,
+ * since collecting it requires a search of all connections.
+ *
+ * @ingroup Devices
+ */
+class spike_statistics_detector : public Node
+{
+
+public:
+  spike_statistics_detector();
+  spike_statistics_detector( const spike_statistics_detector& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+  bool
+  potential_global_receiver() const
+  {
+    return true;
+  }
+  bool
+  local_receiver() const
+  {
+    return true;
+  }
+
+  /**
+   * Import sets of overloaded virtual functions.
+   * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
+   * Hiding
+   */
+  using Node::handle;
+  using Node::handles_test_event;
+
+  void handle( SpikeEvent& );
+
+  port handles_test_event( SpikeEvent&, rport );
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+private:
+  void init_state_( Node const& );
+  void init_buffers_();
+  void calibrate();
+  void post_run_collect();
+
+  /**
+   * Fold all spikes in the read_toggle() segment of the buffer into the
+   * statistics in chronological order and clear the segment.
+   */
+  void update( Time const&, const long, const long );
+
+  // ------------------------------------------------------------
+
+  /**
+   * Lightweight record of a buffered spike.
+   */
+  struct Spike_
+  {
+    index sender_;
+    long stamp_;
+    double offset_;
+
+    Spike_( index sender, long stamp, double offset )
+      : sender_( sender )
+      , stamp_( stamp )
+      , offset_( offset )
+    {
+    }
+
+    /**
+     * Order by spike time; a larger offset means an earlier spike.
+     */
+    bool operator<( const Spike_& other ) const
+    {
+      if ( stamp_ != other.stamp_ )
+      {
+        return stamp_ < other.stamp_;
+      }
+      return offset_ > other.offset_;
+    }
+  };
+
+  /**
+   * Running statistics of the spike train of a single neuron.
+   */
+  struct NeuronStats_
+  {
+    long n_spikes_;      //!< number of spikes
+    long last_stamp_;    //!< time stamp of last spike in steps
+    double last_offset_; //!< offset of last spike in ms
+    long n_isi_;         //!< number of inter-spike intervals
+    double isi_sum_;     //!< sum of intervals in ms
+    double isi_sum_sq_;  //!< sum of squared intervals in ms^2
+
+    NeuronStats_();
+  };
+
+  typedef std::map< index, NeuronStats_ > NeuronStatsMap;
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    Time bin_width_;     //!< width of population count bins
+    Time isi_bin_width_; //!< width of ISI histogram bins
+    Time isi_max_;       //!< upper end of ISI histogram
+
+    Parameters_();                     //!< Sets default parameter values
+    Parameters_( const Parameters_& ); //!< Recalibrate all times
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+
+    /**
+     * Set values from dictionary.
+     * @returns true if the statistics need to be reset.
+     */
+    bool set( const DictionaryDatum&, const spike_statistics_detector& );
+  };
+
+  // ------------------------------------------------------------
+
+  /**
+   * Statistics collected by a single thread sibling.
+   * @note State_ only contains read-out values, so we copy-construct
+   *       using the default c'tor.
+   */
+  struct State_
+  {
+    long n_events_;                         //!< number of recorded spikes
+    NeuronStatsMap neurons_;                //!< statistics per sender
+    std::vector< long > population_counts_; //!< spikes per bin
+    std::vector< long > isi_histogram_;     //!< histogram of intervals
+
+    State_();
+
+    /**
+     * Set values from dictionary.
+     * @returns true if the statistics have been reset.
+     */
+    bool set( const DictionaryDatum&, const Parameters_&, bool );
+    void reset( const Parameters_& );
+  };
+
+  // ------------------------------------------------------------
+
+  /**
+   * Statistics combined across threads and processes.
+   * Only filled in the sibling on thread 0 by post_run_collect().
+   */
+  struct Results_
+  {
+    long n_events_;
+    std::vector< long > population_counts_;
+    std::vector< long > isi_histogram_;
+    std::vector< long > senders_;
+    std::vector< long > spike_counts_;
+    std::vector< double > rates_;
+    std::vector< double > cvs_;
+    double mean_rate_;
+    double mean_cv_;
+
+    Results_();
+
+    void get( DictionaryDatum& ) const;
+    void clear();
+  };
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    std::vector< std::vector< Spike_ > > spikes_;
+
+    /**
+     * Number of distinct connected senders on all processes, computed by
+     * post_run_collect() of the sibling on thread 0. It is recomputed only
+     * if the number of connections on any process has changed since.
+     */
+    size_t n_connected_;
+    size_t n_connections_; //!< local number of connections at computation
+    bool connected_valid_; //!< false until n_connected_ is computed
+  };
+
+  // ------------------------------------------------------------
+
+  void record_spike_( const Spike_& );
+
+  PseudoRecordingDevice device_;
+  Parameters_ P_;
+  State_ S_;
+  Results_ R_;
+  Buffers_ B_;
+};
+
+inline port
+spike_statistics_detector::handles_test_event( SpikeEvent&,
+  rport receptor_type )
+{
+  if ( receptor_type != 0 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+  return 0;
+}
+
+} // namespace
+
+#endif /* #ifndef SPIKE_STATISTICS_DETECTOR_H */
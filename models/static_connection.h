@@ -168,11 +168,50 @@ public:
 
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  bool
+  get_property( const Name& name, double& value ) const
+  {
+    if ( name == names::weight )
+    {
+      value = weight_;
+      return true;
+    }
+    return ConnectionBase::get_property( name, value );
+  }
+
+  bool
+  set_property( const Name& name, double value, ConnectorModel& cm )
+  {
+    if ( name == names::weight )
+    {
+      weight_ = value;
+      return true;
+    }
+    return ConnectionBase::set_property( name, value, cm );
+  }
+
   void
   set_weight( double w )
   {
     weight_ = w;
   }
+
+  /**
+   * Store the weight in a checkpoint, see Connection::save_state().
+   */
+  void
+  save_state( CheckpointWriter& writer ) const
+  {
+    ConnectionBase::save_base_state_( writer );
+    writer.write( weight_ );
+  }
+
+  void
+  restore_state( CheckpointReader& reader )
+  {
+    ConnectionBase::restore_base_state_( reader );
+    reader.read( weight_ );
+  }
 };
 
 template < typename targetidentifierT >
@@ -180,6 +180,22 @@ public:
       "be changed via "
       "CopyModel()." );
   }
+
+  /**
+   * Store the connection in a checkpoint, see Connection::save_state().
+   * The weight is a common property and is not stored.
+   */
+  void
+  save_state( CheckpointWriter& writer ) const
+  {
+    ConnectionBase::save_base_state_( writer );
+  }
+
+  void
+  restore_state( CheckpointReader& reader )
+  {
+    ConnectionBase::restore_base_state_( reader );
+  }
 };
 
 
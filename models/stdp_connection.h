@@ -131,6 +131,16 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Get weight or Kplus without a dictionary, see Connection::get_property().
+   */
+  bool get_property( const Name& name, double& value ) const;
+
+  /**
+   * Set weight or Kplus without a dictionary, see Connection::set_property().
+   */
+  bool set_property( const Name& name, double value, ConnectorModel& cm );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -176,6 +186,38 @@ public:
     weight_ = w;
   }
 
+  /**
+   * Store the weight, parameters and trace in a checkpoint, see
+   * Connection::save_state().
+   */
+  void
+  save_state( CheckpointWriter& writer ) const
+  {
+    ConnectionBase::save_base_state_( writer );
+    writer.write( weight_ );
+    writer.write( tau_plus_ );
+    writer.write( lambda_ );
+    writer.write( alpha_ );
+    writer.write( mu_plus_ );
+    writer.write( mu_minus_ );
+    writer.write( Wmax_ );
+    writer.write( Kplus_ );
+  }
+
+  void
+  restore_state( CheckpointReader& reader )
+  {
+    ConnectionBase::restore_base_state_( reader );
+    reader.read( weight_ );
+    reader.read( tau_plus_ );
+    reader.read( lambda_ );
+    reader.read( alpha_ );
+    reader.read( mu_plus_ );
+    reader.read( mu_minus_ );
+    reader.read( Wmax_ );
+    reader.read( Kplus_ );
+  }
+
 private:
   double
   facilitate_( double w, double kplus )
@@ -314,6 +356,7 @@ STDPConnection< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< double >( d, names::mu_plus, mu_plus_ );
   def< double >( d, names::mu_minus, mu_minus_ );
   def< double >( d, names::Wmax, Wmax_ );
+  def< double >( d, names::Kplus, Kplus_ );
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
@@ -330,6 +373,7 @@ STDPConnection< targetidentifierT >::set_status( const DictionaryDatum& d,
   updateValue< double >( d, names::mu_plus, mu_plus_ );
   updateValue< double >( d, names::mu_minus, mu_minus_ );
   updateValue< double >( d, names::Wmax, Wmax_ );
+  updateValue< double >( d, names::Kplus, Kplus_ );
 
   // check if weight_ and Wmax_ has the same sign
   if ( not( ( ( weight_ >= 0 ) - ( weight_ < 0 ) )
@@ -339,6 +383,48 @@ STDPConnection< targetidentifierT >::set_status( const DictionaryDatum& d,
   }
 }
 
+template < typename targetidentifierT >
+bool
+STDPConnection< targetidentifierT >::get_property( const Name& name,
+  double& value ) const
+{
+  if ( name == names::weight )
+  {
+    value = weight_;
+    return true;
+  }
+  if ( name == names::Kplus )
+  {
+    value = Kplus_;
+    return true;
+  }
+  return ConnectionBase::get_property( name, value );
+}
+
+template < typename targetidentifierT >
+bool
+STDPConnection< targetidentifierT >::set_property( const Name& name,
+  double value,
+  ConnectorModel& cm )
+{
+  if ( name == names::weight )
+  {
+    if ( not( ( ( value >= 0 ) - ( value < 0 ) )
+           == ( ( Wmax_ >= 0 ) - ( Wmax_ < 0 ) ) ) )
+    {
+      throw BadProperty( "Weight and Wmax must have same sign." );
+    }
+    weight_ = value;
+    return true;
+  }
+  if ( name == names::Kplus )
+  {
+    Kplus_ = value;
+    return true;
+  }
+  return ConnectionBase::set_property( name, value, cm );
+}
+
 } // of namespace nest
 
 #endif // of #ifndef STDP_CONNECTION_H
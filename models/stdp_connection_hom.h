@@ -165,6 +165,16 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Get weight or Kplus without a dictionary, see Connection::get_property().
+   */
+  bool get_property( const Name& name, double& value ) const;
+
+  /**
+   * Set weight or Kplus without a dictionary, see Connection::set_property().
+   */
+  bool set_property( const Name& name, double value, ConnectorModel& cm );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -222,6 +232,27 @@ public:
     t.register_stdp_connection( t_lastspike - get_delay() );
   }
 
+  /**
+   * Store the weight and trace in a checkpoint, see
+   * Connection::save_state(). The parameters are common properties and
+   * are not stored.
+   */
+  void
+  save_state( CheckpointWriter& writer ) const
+  {
+    ConnectionBase::save_base_state_( writer );
+    writer.write( weight_ );
+    writer.write( Kplus_ );
+  }
+
+  void
+  restore_state( CheckpointReader& reader )
+  {
+    ConnectionBase::restore_base_state_( reader );
+    reader.read( weight_ );
+    reader.read( Kplus_ );
+  }
+
 private:
   double
   facilitate_( double w, double kplus, const STDPHomCommonProperties& cp )
@@ -349,6 +380,43 @@ STDPConnectionHom< targetidentifierT >::set_status( const DictionaryDatum& d,
   updateValue< double >( d, names::Kplus, Kplus_ );
 }
 
+template < typename targetidentifierT >
+bool
+STDPConnectionHom< targetidentifierT >::get_property( const Name& name,
+  double& value ) const
+{
+  if ( name == names::weight )
+  {
+    value = weight_;
+    return true;
+  }
+  if ( name == names::Kplus )
+  {
+    value = Kplus_;
+    return true;
+  }
+  return ConnectionBase::get_property( name, value );
+}
+
+template < typename targetidentifierT >
+bool
+STDPConnectionHom< targetidentifierT >::set_property( const Name& name,
+  double value,
+  ConnectorModel& cm )
+{
+  if ( name == names::weight )
+  {
+    weight_ = value;
+    return true;
+  }
+  if ( name == names::Kplus )
+  {
+    Kplus_ = value;
+    return true;
+  }
+  return ConnectionBase::set_property( name, value, cm );
+}
+
 } // of namespace nest
 
 #endif // of #ifndef STDP_CONNECTION_HOM_H
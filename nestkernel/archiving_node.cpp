@@ -29,6 +29,9 @@
 
 #include "archiving_node.h"
 
+// Includes from nestkernel:
+#include "checkpoint.h"
+
 // Includes from sli:
 #include "dictutils.h"
 
@@ -337,6 +340,60 @@ nest::Archiving_Node::clear_history()
   Ca_t_ = 0.0;
 }
 
+void
+nest::Archiving_Node::save_state( CheckpointWriter& ) const
+{
+  checkpoint_not_supported_();
+}
+
+void
+nest::Archiving_Node::restore_state( CheckpointReader& )
+{
+  checkpoint_not_supported_();
+}
+
+void
+nest::Archiving_Node::save_history_( CheckpointWriter& writer ) const
+{
+  writer.write( Kminus_ );
+  writer.write( triplet_Kminus_ );
+  writer.write( last_spike_ );
+  writer.write( Ca_t_ );
+  writer.write( Ca_minus_ );
+  writer.write< size_t >( history_.size() );
+  for ( std::deque< histentry >::const_iterator it = history_.begin();
+        it != history_.end();
+        ++it )
+  {
+    writer.write( it->t_ );
+    writer.write( it->Kminus_ );
+    writer.write( it->triplet_Kminus_ );
+    writer.write( it->access_counter_ );
+  }
+}
+
+void
+nest::Archiving_Node::restore_history_( CheckpointReader& reader )
+{
+  reader.read( Kminus_ );
+  reader.read( triplet_Kminus_ );
+  reader.read( last_spike_ );
+  reader.read( Ca_t_ );
+  reader.read( Ca_minus_ );
+  size_t n = 0;
+  reader.read( n );
+  history_.clear();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    histentry entry( 0.0, 0.0, 0.0, 0 );
+    reader.read( entry.t_ );
+    reader.read( entry.Kminus_ );
+    reader.read( entry.triplet_Kminus_ );
+    reader.read( entry.access_counter_ );
+    history_.push_back( entry );
+  }
+}
+
 
 /* ----------------------------------------------------------------
 * Get the number of synaptic_elements
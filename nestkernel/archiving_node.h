@@ -170,6 +170,15 @@ public:
   void get_status( DictionaryDatum& d ) const;
   void set_status( const DictionaryDatum& d );
 
+  /**
+   * Neuron models must explicitly support checkpoints, since they have
+   * dynamic state, so the default implementations throw NotImplemented.
+   * Models that override them should store their history using
+   * save_history_() and restore_history_().
+   */
+  void save_state( CheckpointWriter& ) const;
+  void restore_state( CheckpointReader& );
+
   /**
    * retrieve the current value of tau_Ca which defines the exponential decay
    * constant of the intracellular calcium concentration
@@ -195,6 +204,14 @@ protected:
    */
   void clear_history();
 
+  /**
+   * Store the spike history and calcium concentration in a checkpoint.
+   * The number of incoming STDP connections is not stored, since it is
+   * recomputed when the connections are restored.
+   */
+  void save_history_( CheckpointWriter& ) const;
+  void restore_history_( CheckpointReader& );
+
 private:
   // number of incoming connections from stdp connectors.
   // needed to determine, if every incoming connection has
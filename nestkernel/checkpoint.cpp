@@ -0,0 +1,98 @@
+/*
+ *  checkpoint.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "checkpoint.h"
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "sliexceptions.h"
+
+std::string
+nest::checkpoint_file_name( const std::string& prefix, int rank )
+{
+  return String::compose( "%1-%2.ckpt", prefix, rank );
+}
+
+nest::CheckpointWriter::CheckpointWriter( const std::string& filename )
+  : filename_( filename )
+  , out_( filename.c_str(), std::ios::binary | std::ios::trunc )
+{
+  if ( not out_.good() )
+  {
+    LOG( M_ERROR,
+      "CheckpointWriter",
+      String::compose( "Cannot open file '%1' for writing.", filename ) );
+    throw IOError();
+  }
+}
+
+void
+nest::CheckpointWriter::close()
+{
+  out_.close();
+  if ( out_.fail() )
+  {
+    LOG( M_ERROR,
+      "CheckpointWriter",
+      String::compose( "Error writing file '%1'.", filename_ ) );
+    throw IOError();
+  }
+}
+
+nest::CheckpointReader::CheckpointReader( const std::string& filename )
+  : filename_( filename )
+  , in_( filename.c_str(), std::ios::binary )
+{
+  if ( not in_.good() )
+  {
+    LOG( M_ERROR,
+      "CheckpointReader",
+      String::compose( "Cannot open file '%1'.", filename ) );
+    throw IOError();
+  }
+}
+
+void
+nest::CheckpointReader::check_()
+{
+  if ( in_.fail() )
+  {
+    throw BadProperty(
+      String::compose( "Checkpoint file '%1' is truncated.", filename_ ) );
+  }
+}
+
+void
+nest::CheckpointReader::mismatch_( const std::string& what ) const
+{
+  throw BadProperty(
+    String::compose( "The %1 differs from the checkpoint in '%2'.",
+      what,
+      filename_ ) );
+}
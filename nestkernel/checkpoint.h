@@ -0,0 +1,190 @@
+/*
+ *  checkpoint.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+// C++ includes:
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Return the name of the checkpoint file of the given rank.
+ */
+std::string checkpoint_file_name( const std::string& prefix, int rank );
+
+/**
+ * Binary output stream for checkpoints.
+ *
+ * Checkpoints store the state of the kernel and of all local nodes and
+ * connections of one MPI process, see KernelManager::save_checkpoint().
+ * Values are stored as their object representation, so write() must only
+ * be used for types that can be copied bytewise. Checkpoints can only be
+ * restored by the same NEST binary on the same kind of machine.
+ */
+class CheckpointWriter
+{
+public:
+  /**
+   * Open the given file for writing.
+   * @throws IOError if the file cannot be opened.
+   */
+  explicit CheckpointWriter( const std::string& filename );
+
+  template < typename T >
+  void write( const T& );
+
+  void write( const std::string& );
+
+  template < typename T >
+  void write_vector( const std::vector< T >& );
+
+  /**
+   * Close the file.
+   * @throws IOError if an error occurred while writing.
+   */
+  void close();
+
+private:
+  std::string filename_;
+  std::ofstream out_;
+};
+
+/**
+ * Binary input stream for checkpoints written by CheckpointWriter.
+ */
+class CheckpointReader
+{
+public:
+  /**
+   * Open the given file for reading.
+   * @throws IOError if the file cannot be opened.
+   */
+  explicit CheckpointReader( const std::string& filename );
+
+  /**
+   * Read a value.
+   * @throws BadProperty if the file ends prematurely.
+   */
+  template < typename T >
+  void read( T& );
+
+  void read( std::string& );
+
+  template < typename T >
+  void read_vector( std::vector< T >& );
+
+  /**
+   * Read a value and compare it to the value of the running simulation.
+   * @throws BadProperty if the values differ.
+   */
+  template < typename T >
+  void expect( const T&, const std::string& what );
+
+private:
+  void check_(); //!< throw BadProperty if the last read failed
+  void mismatch_( const std::string& what ) const;
+
+  std::string filename_;
+  std::ifstream in_;
+};
+
+template < typename T >
+inline void
+CheckpointWriter::write( const T& value )
+{
+  out_.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+inline void
+CheckpointWriter::write( const std::string& value )
+{
+  write< size_t >( value.size() );
+  out_.write( value.data(), value.size() );
+}
+
+template < typename T >
+inline void
+CheckpointWriter::write_vector( const std::vector< T >& values )
+{
+  write< size_t >( values.size() );
+  if ( not values.empty() )
+  {
+    out_.write( reinterpret_cast< const char* >( &values[ 0 ] ),
+      values.size() * sizeof( T ) );
+  }
+}
+
+template < typename T >
+inline void
+CheckpointReader::read( T& value )
+{
+  in_.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+  check_();
+}
+
+inline void
+CheckpointReader::read( std::string& value )
+{
+  size_t size = 0;
+  read( size );
+  value.resize( size );
+  if ( size > 0 )
+  {
+    in_.read( &value[ 0 ], size );
+    check_();
+  }
+}
+
+template < typename T >
+inline void
+CheckpointReader::read_vector( std::vector< T >& values )
+{
+  size_t size = 0;
+  read( size );
+  values.resize( size );
+  if ( size > 0 )
+  {
+    in_.read( reinterpret_cast< char* >( &values[ 0 ] ), size * sizeof( T ) );
+    check_();
+  }
+}
+
+template < typename T >
+inline void
+CheckpointReader::expect( const T& value, const std::string& what )
+{
+  T stored;
+  read( stored );
+  if ( not( stored == value ) )
+  {
+    mismatch_( what );
+  }
+}
+
+} // namespace nest
+
+#endif /* CHECKPOINT_H */
@@ -23,6 +23,8 @@
 #include "conn_builder.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 // Includes from libnestutil:
@@ -37,6 +39,7 @@
 // Includes from nestkernel:
 #include "conn_builder_impl.h"
 #include "conn_parameter.h"
+#include "connectome_file.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_names.h"
@@ -62,6 +65,8 @@ nest::ConnBuilder::ConnBuilder( const GIDCollection& sources,
       "static_synapse" ) )
   , weight_( 0 )
   , delay_( 0 )
+  , weight_blocks_( 0 )
+  , delay_blocks_( 0 )
   , param_dicts_()
   , parameters_requiring_skipping_()
 {
@@ -138,6 +143,19 @@ nest::ConnBuilder::ConnBuilder( const GIDCollection& sources,
   }
   register_parameters_requiring_skipping_( *delay_ );
 
+  // Random weights and delays are drawn in blocks, which is considerably
+  // faster for large numbers of connections.
+  if ( weight_ and not weight_->is_array() and not weight_->is_scalar() )
+  {
+    weight_blocks_ = new ConnParameterBlocks(
+      *weight_, kernel().vp_manager.get_num_threads() );
+  }
+  if ( delay_ and not delay_->is_array() and not delay_->is_scalar() )
+  {
+    delay_blocks_ = new ConnParameterBlocks(
+      *delay_, kernel().vp_manager.get_num_threads() );
+  }
+
   // Structural plasticity parameters
   // Check if both pre and post synaptic element are provided
   if ( syn_spec->known( names::pre_synaptic_element )
@@ -247,6 +265,8 @@ nest::ConnBuilder::ConnBuilder( const GIDCollection& sources,
 
 nest::ConnBuilder::~ConnBuilder()
 {
+  delete weight_blocks_;
+  delete delay_blocks_;
   delete weight_;
   delete delay_;
   for ( std::map< Name, ConnParameter* >::iterator it = synapse_params_.begin();
@@ -347,10 +367,12 @@ nest::ConnBuilder::connect()
         "structural plasticity." );
     }
     sp_connect_();
+    flush_staged_connections_();
   }
   else
   {
     connect_();
+    flush_staged_connections_();
     if ( make_symmetric_ )
     {
       // call reset on all parameters
@@ -371,6 +393,7 @@ nest::ConnBuilder::connect()
 
       std::swap( sources_, targets_ );
       connect_();
+      flush_staged_connections_();
       std::swap( sources_, targets_ ); // re-establish original state
     }
   }
@@ -427,31 +450,31 @@ nest::ConnBuilder::single_connect_( index sgid,
   {
     if ( default_weight_and_delay_ )
     {
-      kernel().connection_manager.connect(
+      kernel().connection_manager.stage_connection(
         sgid, &target, target_thread, synapse_model_id_ );
     }
     else if ( default_weight_ )
     {
-      kernel().connection_manager.connect( sgid,
+      kernel().connection_manager.stage_connection( sgid,
         &target,
         target_thread,
         synapse_model_id_,
-        delay_->value_double( target_thread, rng ) );
+        delay_value_( target_thread, rng ) );
     }
     else if ( default_delay_ )
     {
-      kernel().connection_manager.connect( sgid,
+      kernel().connection_manager.stage_connection( sgid,
         &target,
         target_thread,
         synapse_model_id_,
         numerics::nan,
-        weight_->value_double( target_thread, rng ) );
+        weight_value_( target_thread, rng ) );
     }
     else
     {
-      double delay = delay_->value_double( target_thread, rng );
-      double weight = weight_->value_double( target_thread, rng );
-      kernel().connection_manager.connect(
+      double delay = delay_value_( target_thread, rng );
+      double weight = weight_value_( target_thread, rng );
+      kernel().connection_manager.stage_connection(
         sgid, &target, target_thread, synapse_model_id_, delay, weight );
     }
   }
@@ -514,7 +537,7 @@ nest::ConnBuilder::single_connect_( index sgid,
         target_thread,
         synapse_model_id_,
         param_dicts_[ target_thread ],
-        delay_->value_double( target_thread, rng ) );
+        delay_value_( target_thread, rng ) );
     }
     else if ( default_delay_ )
     {
@@ -524,12 +547,12 @@ nest::ConnBuilder::single_connect_( index sgid,
         synapse_model_id_,
         param_dicts_[ target_thread ],
         numerics::nan,
-        weight_->value_double( target_thread, rng ) );
+        weight_value_( target_thread, rng ) );
     }
     else
     {
-      double delay = delay_->value_double( target_thread, rng );
-      double weight = weight_->value_double( target_thread, rng );
+      double delay = delay_value_( target_thread, rng );
+      double weight = weight_value_( target_thread, rng );
       kernel().connection_manager.connect( sgid,
         &target,
         target_thread,
@@ -541,6 +564,28 @@ nest::ConnBuilder::single_connect_( index sgid,
   }
 }
 
+void
+nest::ConnBuilder::flush_staged_connections_()
+{
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      kernel().connection_manager.flush_staged_connections( tid );
+    }
+    catch ( std::exception& err )
+    {
+      // keep the exception that stopped the connection loop, if any
+      if ( not exceptions_raised_.at( tid ).valid() )
+      {
+        exceptions_raised_.at( tid ) = lockPTR< WrappedThreadException >(
+          new WrappedThreadException( err ) );
+      }
+    }
+  }
+}
+
 void
 nest::ConnBuilder::set_pre_synaptic_element_name( const std::string& name )
 {
@@ -1129,7 +1174,7 @@ nest::FixedInDegreeBuilder::FixedInDegreeBuilder( const GIDCollection& sources,
         "FixedInDegreeBuilder::connect",
         "Multapses and autapses prohibited. When the sources and the targets "
         "have a non-empty "
-        "intersection, the connect algorithm will enter an infinite loop." );
+        "intersection, Connect will fail." );
       return;
     }
 
@@ -1282,7 +1327,7 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder(
         "FixedOutDegreeBuilder::connect",
         "Multapses and autapses prohibited. When the sources and the targets "
         "have a non-empty "
-        "intersection, the connect algorithm will enter an infinite loop." );
+        "intersection, Connect will fail." );
       return;
     }
 
@@ -1304,16 +1349,177 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder(
 void
 nest::FixedOutDegreeBuilder::connect_()
 {
+  // Each virtual process creates only the connections to its own targets.
+  // The outdegree of each source is first partitioned over virtual
+  // processes using the global RNG, identically on all processes. Each
+  // thread then draws the targets of its share from the targets on its
+  // virtual process using its own RNG.
+
+  const long n_vps = kernel().vp_manager.get_num_virtual_processes();
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+  const size_t n_sources = sources_->size();
+
+  // distribution of targets over virtual processes, local targets per thread
+  std::vector< long > targets_on_vp( n_vps, 0 );
+  std::vector< std::vector< index > > targets_on_thread( n_threads );
+  for ( GIDCollection::const_iterator tgid = targets_->begin();
+        tgid != targets_->end();
+        ++tgid )
+  {
+    const thread vp = kernel().vp_manager.suggest_vp( *tgid );
+    ++targets_on_vp[ vp ];
+    if ( kernel().vp_manager.is_local_vp( vp ) )
+    {
+      targets_on_thread[ kernel().vp_manager.vp_to_thread( vp ) ].push_back(
+        *tgid );
+    }
+  }
+
+  if ( not autapses_ and not targets_->is_range() )
+  {
+    sorted_targets_.reserve( targets_->size() );
+    for ( GIDCollection::const_iterator tgid = targets_->begin();
+          tgid != targets_->end();
+          ++tgid )
+    {
+      sorted_targets_.push_back( *tgid );
+    }
+    std::sort( sorted_targets_.begin(), sorted_targets_.end() );
+  }
+
+  // Number of connections of each source on each local thread and, if
+  // array parameters need skipping, the number of connections of the
+  // source on lower virtual processes. Array parameters are thus assigned
+  // to connections of a source in the order of virtual processes.
+  const bool skipping = not parameters_requiring_skipping_.empty();
+  std::vector< std::vector< long > > conns_on_thread(
+    n_threads, std::vector< long >( n_sources, 0 ) );
+  std::vector< std::vector< long > > conns_before_thread;
+  if ( skipping )
+  {
+    conns_before_thread.resize( n_threads, std::vector< long >( n_sources ) );
+  }
+
+  // Only virtual processes with connections are visited. Threads without
+  // connections of a source skip all its array parameters, whatever their
+  // number of connections before.
   librandom::RngPtr grng = kernel().rng_manager.get_grng();
+  std::vector< std::pair< long, long > > shares;
+  for ( size_t s = 0; s < n_sources; ++s )
+  {
+    partition_outdegree_( ( *sources_ )[ s ], targets_on_vp, grng, shares );
 
-  for ( GIDCollection::const_iterator sgid = sources_->begin();
-        sgid != sources_->end();
-        ++sgid )
+    long conns_before = 0;
+    for ( std::vector< std::pair< long, long > >::const_iterator share =
+            shares.begin();
+          share != shares.end();
+          ++share )
+    {
+      if ( kernel().vp_manager.is_local_vp( share->first ) )
+      {
+        const thread t = kernel().vp_manager.vp_to_thread( share->first );
+        conns_on_thread[ t ][ s ] = share->second;
+        if ( skipping )
+        {
+          conns_before_thread[ t ][ s ] = conns_before;
+        }
+      }
+      conns_before += share->second;
+    }
+  }
+
+#pragma omp parallel
   {
-    std::set< long > ch_ids;
-    std::vector< index > tgt_ids_;
-    const long n_rnd = targets_->size();
+    // get thread id
+    const int tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      // allocate pointer to thread specific random generator
+      librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
+
+      const std::vector< index >& local_targets = targets_on_thread[ tid ];
+      std::set< long > ch_ids;
+
+      for ( size_t s = 0; s < n_sources; ++s )
+      {
+        const index sgid = ( *sources_ )[ s ];
+        const long n_conns = conns_on_thread[ tid ][ s ];
+
+        // skip array parameters handled in other virtual processes
+        const long n_before = skipping ? conns_before_thread[ tid ][ s ] : 0;
+        if ( n_before > 0 )
+        {
+          skip_conn_parameter_( tid, n_before );
+        }
+
+        for ( long j = 0; j < n_conns; ++j )
+        {
+          unsigned long t_id;
+          index tgid;
+
+          do
+          {
+            t_id = rng->ulrand( local_targets.size() );
+            tgid = local_targets[ t_id ];
+          } while ( ( not autapses_ and tgid == sgid )
+            or ( not multapses_ and ch_ids.find( t_id ) != ch_ids.end() ) );
+          if ( not multapses_ )
+          {
+            ch_ids.insert( t_id );
+          }
+
+          Node* const target = kernel().node_manager.get_node( tgid, tid );
+          single_connect_( sgid, *target, tid, rng );
+        }
+        ch_ids.clear();
+
+        const long n_after = skipping ? outdegree_ - n_before - n_conns : 0;
+        if ( n_after > 0 )
+        {
+          skip_conn_parameter_( tid, n_after );
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at( tid ) =
+        lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+}
+
+void
+nest::FixedOutDegreeBuilder::partition_outdegree_( index sgid,
+  const std::vector< long >& targets_on_vp,
+  librandom::RngPtr& grng,
+  std::vector< std::pair< long, long > >& shares ) const
+{
+  shares.clear();
+  const long n_vps = targets_on_vp.size();
+  const long n_targets = targets_->size();
+
+  // targets equal to the source must not be drawn if autapses are
+  // prohibited; they all reside on the virtual process of the source
+  const long n_excluded = autapses_ ? 0 : count_in_targets_( sgid );
+  const thread excluded_vp = kernel().vp_manager.suggest_vp( sgid );
 
+  if ( not multapses_ and outdegree_ > n_targets - n_excluded )
+  {
+    throw BadProperty(
+      "Outdegree cannot be larger than the number of possible targets "
+      "if multapses and autapses are prohibited." );
+  }
+
+  if ( outdegree_ < n_vps )
+  {
+    // few connections: draw the index of each target as if connecting
+    // serially and only keep the virtual process of the target
+    std::set< long > ch_ids;
+    std::vector< long > vps;
+    vps.reserve( outdegree_ );
     for ( long j = 0; j < outdegree_; ++j )
     {
       unsigned long t_id;
@@ -1321,63 +1527,184 @@ nest::FixedOutDegreeBuilder::connect_()
 
       do
       {
-        t_id = grng->ulrand( n_rnd );
+        t_id = grng->ulrand( n_targets );
         tgid = ( *targets_ )[ t_id ];
-      } while ( ( not autapses_ and tgid == *sgid )
+      } while ( ( not autapses_ and tgid == sgid )
         or ( not multapses_ and ch_ids.find( t_id ) != ch_ids.end() ) );
       if ( not multapses_ )
       {
         ch_ids.insert( t_id );
       }
 
-      tgt_ids_.push_back( tgid );
+      vps.push_back( kernel().vp_manager.suggest_vp( tgid ) );
     }
 
-#pragma omp parallel
+    std::sort( vps.begin(), vps.end() );
+    for ( std::vector< long >::const_iterator vp = vps.begin();
+          vp != vps.end();
+          ++vp )
     {
-      // get thread id
-      const int tid = kernel().vp_manager.get_thread_id();
+      if ( shares.empty() or shares.back().first != *vp )
+      {
+        shares.push_back( std::make_pair( *vp, 0L ) );
+      }
+      ++shares.back().second;
+    }
+    return;
+  }
 
-      try
+  // many connections: multinomial (with multapses) or multivariate
+  // hypergeometric (without multapses) partition over virtual processes,
+  // drawn as a sequence of conditional binomial or hypergeometric numbers
+#ifdef HAVE_GSL
+  librandom::GSL_BinomialRandomDev bino( grng, 0, 0 );
+#else
+  librandom::BinomialRandomDev bino( grng, 0, 0 );
+#endif
+
+  long remaining_targets = n_targets - n_excluded;
+  long remaining_conns = outdegree_;
+  for ( long vp = 0; vp < n_vps and remaining_conns > 0; ++vp )
+  {
+    long n_vp = targets_on_vp[ vp ];
+    if ( vp == excluded_vp )
+    {
+      n_vp -= n_excluded;
+    }
+    if ( n_vp == 0 )
+    {
+      continue;
+    }
+
+    long n_conns = 0;
+    if ( multapses_ )
+    {
+      bino.set_p( static_cast< double >( n_vp ) / remaining_targets );
+      bino.set_n( remaining_conns );
+      n_conns = bino.ldev();
+    }
+    else
+    {
+      n_conns = hypergeometric_(
+        grng, n_vp, remaining_targets - n_vp, remaining_conns );
+    }
+    if ( n_conns > 0 )
+    {
+      shares.push_back( std::make_pair( vp, n_conns ) );
+    }
+
+    remaining_targets -= n_vp;
+    remaining_conns -= n_conns;
+  }
+}
+
+long
+nest::FixedOutDegreeBuilder::count_in_targets_( index gid ) const
+{
+  if ( targets_->is_range() )
+  {
+    return ( ( *targets_ )[ 0 ] <= gid
+             and gid <= ( *targets_ )[ targets_->size() - 1 ] )
+      ? 1
+      : 0;
+  }
+
+  std::pair< std::vector< index >::const_iterator,
+    std::vector< index >::const_iterator > range =
+    std::equal_range( sorted_targets_.begin(), sorted_targets_.end(), gid );
+  return range.second - range.first;
+}
+
+long
+nest::FixedOutDegreeBuilder::hypergeometric_( librandom::RngPtr& rng,
+  long n_good,
+  long n_bad,
+  long n_draw )
+{
+  if ( n_draw == 0 or n_good == 0 )
+  {
+    return 0;
+  }
+  if ( n_bad == 0 )
+  {
+    return n_draw;
+  }
+
+  if ( n_draw < 16 )
+  {
+    // draw items one by one
+    long k = 0;
+    long good = n_good;
+    long total = n_good + n_bad;
+    for ( long i = 0; i < n_draw; ++i, --total )
+    {
+      if ( rng->ulrand( total ) < static_cast< unsigned long >( good ) )
       {
-        // allocate pointer to thread specific random generator
-        librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
+        ++k;
+        --good;
+      }
+    }
+    return k;
+  }
 
-        for ( std::vector< index >::const_iterator tgid = tgt_ids_.begin();
-              tgid != tgt_ids_.end();
-              ++tgid )
-        {
-          // check whether the target is on this mpi machine
-          if ( not kernel().node_manager.is_local_gid( *tgid ) )
-          {
-            // skip array parameters handled in other virtual processes
-            skip_conn_parameter_( tid );
-            continue;
-          }
+  // inversion by chop-down search starting from the mode, which needs
+  // O(standard deviation) steps on average
+  const long n_total = n_good + n_bad;
+  const long k_min = std::max( 0L, n_draw - n_bad );
+  const long k_max = std::min( n_draw, n_good );
+  const long mode = std::max( k_min,
+    std::min( k_max,
+      static_cast< long >( ( n_draw + 1.0 ) * ( n_good + 1.0 )
+        / ( n_total + 2.0 ) ) ) );
 
-          Node* const target = kernel().node_manager.get_node( *tgid, tid );
-          const thread target_thread = target->get_thread();
+  const double log_p_mode = lgamma( n_good + 1.0 ) - lgamma( mode + 1.0 )
+    - lgamma( n_good - mode + 1.0 ) + lgamma( n_bad + 1.0 )
+    - lgamma( n_draw - mode + 1.0 ) - lgamma( n_bad - n_draw + mode + 1.0 )
+    - lgamma( n_total + 1.0 ) + lgamma( n_draw + 1.0 )
+    + lgamma( n_total - n_draw + 1.0 );
+  const double p_mode = std::exp( log_p_mode );
 
-          // check whether the target is on our thread
-          if ( tid != target_thread )
-          {
-            // skip array parameters handled in other virtual processes
-            skip_conn_parameter_( tid );
-            continue;
-          }
+  double u = rng->drand() - p_mode;
+  if ( u <= 0 )
+  {
+    return mode;
+  }
 
-          single_connect_( *sgid, *target, target_thread, rng );
-        }
+  long k_up = mode;
+  long k_down = mode;
+  double p_up = p_mode;
+  double p_down = p_mode;
+  while ( k_up < k_max or k_down > k_min )
+  {
+    if ( k_up < k_max )
+    {
+      // P(k+1) / P(k)
+      p_up *= static_cast< double >( n_good - k_up ) * ( n_draw - k_up )
+        / ( ( k_up + 1.0 ) * ( n_bad - n_draw + k_up + 1.0 ) );
+      ++k_up;
+      u -= p_up;
+      if ( u <= 0 )
+      {
+        return k_up;
       }
-      catch ( std::exception& err )
+    }
+    if ( k_down > k_min )
+    {
+      // P(k-1) / P(k)
+      p_down *= static_cast< double >( k_down )
+        * ( n_bad - n_draw + k_down )
+        / ( ( n_good - k_down + 1.0 ) * ( n_draw - k_down + 1.0 ) );
+      --k_down;
+      u -= p_down;
+      if ( u <= 0 )
       {
-        // We must create a new exception here, err's lifetime ends at
-        // the end of the catch block.
-        exceptions_raised_.at( tid ) = lockPTR< WrappedThreadException >(
-          new WrappedThreadException( err ) );
+        return k_down;
       }
     }
   }
+
+  // only reached through rounding errors
+  return mode;
 }
 
 nest::FixedTotalNumberBuilder::FixedTotalNumberBuilder(
@@ -1432,16 +1759,18 @@ nest::FixedTotalNumberBuilder::connect_()
   // Compute the distribution of targets over processes using the modulo
   // function
   std::vector< size_t > number_of_targets_on_vp( M, 0 );
-  std::vector< index > local_targets;
-  local_targets.reserve(
-    size_targets / kernel().mpi_manager.get_num_processes() );
-  for ( size_t t = 0; t < targets_->size(); t++ )
+  std::vector< std::vector< index > > targets_on_thread(
+    kernel().vp_manager.get_num_threads() );
+  for ( GIDCollection::const_iterator tgid = targets_->begin();
+        tgid != targets_->end();
+        ++tgid )
   {
-    int vp = kernel().vp_manager.suggest_vp( ( *targets_ )[ t ] );
+    const int vp = kernel().vp_manager.suggest_vp( *tgid );
     ++number_of_targets_on_vp[ vp ];
     if ( kernel().vp_manager.is_local_vp( vp ) )
     {
-      local_targets.push_back( ( *targets_ )[ t ] );
+      targets_on_thread[ kernel().vp_manager.vp_to_thread( vp ) ].push_back(
+        *tgid );
     }
   }
 
@@ -1508,18 +1837,8 @@ nest::FixedTotalNumberBuilder::connect_()
       {
         librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
 
-        // gather local target gids
-        std::vector< index > thread_local_targets;
-        thread_local_targets.reserve( number_of_targets_on_vp[ vp_id ] );
-        for ( std::vector< index >::const_iterator it = local_targets.begin();
-              it != local_targets.end();
-              ++it )
-        {
-          if ( kernel().vp_manager.suggest_vp( *it ) == vp_id )
-          {
-            thread_local_targets.push_back( *it );
-          }
-        }
+        const std::vector< index >& thread_local_targets =
+          targets_on_thread[ tid ];
         assert(
           thread_local_targets.size() == number_of_targets_on_vp[ vp_id ] );
 
@@ -1652,21 +1971,214 @@ nest::BernoulliBuilder::inner_connect_( const int tid,
   // It is not possible to create multapses with this type of BernoulliBuilder,
   // hence leave out corresponding checks.
 
-  for ( GIDCollection::const_iterator sgid = sources_->begin();
-        sgid != sources_->end();
-        ++sgid )
+  if ( p_ == 0. )
   {
-    if ( not autapses_ and *sgid == tgid )
+    return;
+  }
+
+  // Instead of drawing a random number for each source, we draw the number
+  // of sources skipped before the next accepted source. For independent
+  // trials with probability p, this number is geometrically distributed,
+  //   P(skip = k) = (1-p)^k p,
+  // and obtained by inversion as floor( log(U) / log(1-p) ) with U uniform
+  // in (0, 1]. The cost is thus proportional to the number of connections.
+  // log1p() keeps log(1-p) from rounding to zero for very small p.
+  const double log_q = std::log1p( -p_ ); // -inf for p = 1, no skipping
+  const size_t n_sources = sources_->size();
+
+  size_t i = 0;
+  while ( true )
+  {
+    const double skip = std::floor( std::log( rng->drandpos() ) / log_q );
+    // the skip is compared as a double, so that skips too large for size_t
+    // and undefined skips end the loop before they are converted
+    if ( not( skip < static_cast< double >( n_sources - i ) ) )
     {
-      continue;
+      break;
     }
+    i += static_cast< size_t >( skip );
 
-    if ( rng->drand() >= p_ )
+    const index sgid = ( *sources_ )[ i ];
+    if ( autapses_ or sgid != tgid )
     {
-      continue;
+      single_connect_( sgid, *target, target_thread, rng );
     }
 
-    single_connect_( *sgid, *target, target_thread, rng );
+    ++i;
+  }
+}
+
+nest::FromFileBuilder::FromFileBuilder( const GIDCollection& sources,
+  const GIDCollection& targets,
+  const DictionaryDatum& conn_spec,
+  const DictionaryDatum& syn_spec )
+  : ConnBuilder( sources, targets, conn_spec, syn_spec )
+  , prefix_()
+  , sorted_sources_()
+  , sorted_targets_()
+{
+  if ( not updateValue< std::string >( conn_spec, names::filename, prefix_ ) )
+  {
+    throw BadProperty( "Connection rule from_file requires a filename." );
+  }
+
+  if ( not multapses_ )
+  {
+    throw BadProperty(
+      "Connection rule from_file does not support excluding multapses." );
+  }
+
+  for ( Dictionary::const_iterator it = syn_spec->begin();
+        it != syn_spec->end();
+        ++it )
+  {
+    if ( it->first != names::model )
+    {
+      throw BadProperty(
+        "Connection rule from_file takes synapse models, weights and delays "
+        "from the connectome file, syn_spec must not contain parameters." );
+    }
+  }
+
+  if ( not sources_->is_range() )
+  {
+    sorted_sources_.reserve( sources_->size() );
+    for ( GIDCollection::const_iterator sgid = sources_->begin();
+          sgid != sources_->end();
+          ++sgid )
+    {
+      sorted_sources_.push_back( *sgid );
+    }
+    std::sort( sorted_sources_.begin(), sorted_sources_.end() );
+  }
+
+  if ( not targets_->is_range() )
+  {
+    sorted_targets_.reserve( targets_->size() );
+    for ( GIDCollection::const_iterator tgid = targets_->begin();
+          tgid != targets_->end();
+          ++tgid )
+    {
+      sorted_targets_.push_back( *tgid );
+    }
+    std::sort( sorted_targets_.begin(), sorted_targets_.end() );
+  }
+}
+
+bool
+nest::FromFileBuilder::contains_( const GIDCollection& gids,
+  const std::vector< index >& sorted_gids,
+  index gid ) const
+{
+  if ( gids.is_range() )
+  {
+    return gids.size() > 0 and gids[ 0 ] <= gid
+      and gid <= gids[ gids.size() - 1 ];
+  }
+  return std::binary_search( sorted_gids.begin(), sorted_gids.end(), gid );
+}
+
+void
+nest::FromFileBuilder::connect_()
+{
+  const MappedConnectomeFile first( connectome_file_name( prefix_, 0 ) );
+  const size_t num_files = first.get_header().num_processes_;
+  const int rank = kernel().mpi_manager.get_rank();
+
+  // If the number of processes is unchanged, all targets in the file of this
+  // rank are local. Otherwise, the targets are spread over all files.
+  if ( num_files
+    == static_cast< size_t >( kernel().mpi_manager.get_num_processes() ) )
+  {
+    if ( rank == 0 )
+    {
+      connect_file_( first );
+    }
+    else
+    {
+      const MappedConnectomeFile own( connectome_file_name( prefix_, rank ) );
+      connect_file_( own );
+    }
+    return;
+  }
+
+  connect_file_( first );
+  for ( size_t r = 1; r < num_files; ++r )
+  {
+    const MappedConnectomeFile file( connectome_file_name( prefix_, r ) );
+    connect_file_( file );
+  }
+}
+
+void
+nest::FromFileBuilder::connect_file_( const MappedConnectomeFile& file )
+{
+  // map the model name table of the file to the synapse ids of this kernel
+  const std::vector< std::string >& models = file.get_models();
+  std::vector< synindex > syn_ids( models.size() );
+  for ( size_t m = 0; m < models.size(); ++m )
+  {
+    const Token syn_id =
+      kernel().model_manager.get_synapsedict()->lookup( models[ m ] );
+    if ( syn_id.empty() )
+    {
+      throw UnknownSynapseType( models[ m ] );
+    }
+    syn_ids[ m ] = static_cast< long >( syn_id );
+  }
+
+  const ConnectomeRecord* const records_begin = file.begin();
+  const ConnectomeRecord* const records_end = file.end();
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      // All threads scan all records and each creates the connections to
+      // the targets on its thread.
+      for ( const ConnectomeRecord* record = records_begin;
+            record != records_end;
+            ++record )
+      {
+        const index tgid = record->target_;
+        const index sgid = record->source_;
+
+        if ( not kernel().node_manager.is_local_gid( tgid )
+          or not contains_( *targets_, sorted_targets_, tgid )
+          or not contains_( *sources_, sorted_sources_, sgid )
+          or ( not autapses_ and sgid == tgid ) )
+        {
+          continue;
+        }
+
+        Node* const target = kernel().node_manager.get_node( tgid, tid );
+        if ( target->has_proxies() and target->get_thread() != tid )
+        {
+          continue;
+        }
+
+        if ( record->model_ >= syn_ids.size() )
+        {
+          throw BadProperty( "Invalid synapse model in connectome file." );
+        }
+
+        kernel().connection_manager.stage_connection( sgid,
+          target,
+          tid,
+          syn_ids[ record->model_ ],
+          record->delay_,
+          record->weight_ );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at( tid ) =
+        lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
   }
 }
 
@@ -1709,6 +2221,7 @@ void
 nest::SPBuilder::sp_connect( GIDCollection sources, GIDCollection targets )
 {
   connect_( sources, targets );
+  flush_staged_connections_();
 
   // check if any exceptions have been raised
   for ( size_t thr = 0; thr < kernel().vp_manager.get_num_threads(); ++thr )
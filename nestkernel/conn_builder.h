@@ -33,6 +33,7 @@
 
 // C++ includes:
 #include <map>
+#include <string>
 #include <vector>
 
 // Includes from libnestutil:
@@ -54,6 +55,7 @@ namespace nest
 {
 class Node;
 class ConnParameter;
+class MappedConnectomeFile;
 class SparseNodeArray;
 
 /**
@@ -149,6 +151,12 @@ protected:
 
   //! Create connection between given nodes, fill parameter values
   void single_connect_( index, Node&, thread, librandom::RngPtr& );
+
+  /**
+   * Create all connections staged by single_connect_() on all threads.
+   * Exceptions are stored in exceptions_raised_.
+   */
+  void flush_staged_connections_();
   void single_disconnect_( index, Node&, thread );
 
   /**
@@ -220,6 +228,16 @@ private:
   ConnParameter* weight_;
   ConnParameter* delay_;
 
+  //! random weights and delays drawn in blocks, null-pointer otherwise
+  ConnParameterBlocks* weight_blocks_;
+  ConnParameterBlocks* delay_blocks_;
+
+  //! next weight for a connection on the given thread
+  double weight_value_( thread, librandom::RngPtr& );
+
+  //! next delay for a connection on the given thread
+  double delay_value_( thread, librandom::RngPtr& );
+
   //! all other parameters, mapping name to value representation
   ConnParameterMap synapse_params_;
 
@@ -329,7 +347,43 @@ protected:
   void connect_();
 
 private:
+  /**
+   * Draw the number of connections of source sgid on each virtual process.
+   *
+   * All processes draw identical partitions from the global RNG. Small
+   * outdegrees are partitioned by drawing each target index, large ones by
+   * a sequence of binomial (with multapses) or hypergeometric (without
+   * multapses) draws over the virtual processes with targets.
+   *
+   * @param targets_on_vp Number of targets on each virtual process
+   * @param shares On return, the virtual processes with connections and
+   *               their number of connections, in increasing order of
+   *               virtual processes
+   */
+  void partition_outdegree_( index sgid,
+    const std::vector< long >& targets_on_vp,
+    librandom::RngPtr& grng,
+    std::vector< std::pair< long, long > >& shares ) const;
+
+  /**
+   * Number of entries equal to gid in the target collection.
+   */
+  long count_in_targets_( index gid ) const;
+
+  /**
+   * Draw from the hypergeometric distribution: the number of good items
+   * among n_draw items drawn without replacement from n_good good and
+   * n_bad bad items.
+   */
+  static long hypergeometric_( librandom::RngPtr& rng,
+    long n_good,
+    long n_bad,
+    long n_draw );
+
   long outdegree_;
+
+  //! Sorted target GIDs, only needed to exclude autapses for non-ranges.
+  std::vector< index > sorted_targets_;
 };
 
 class FixedTotalNumberBuilder : public ConnBuilder
@@ -363,6 +417,49 @@ private:
   double p_; //!< connection probability
 };
 
+/**
+ * Create the connections stored in binary connectome files.
+ *
+ * The files are written by DumpConnectome, see connectome_file.h. Weights,
+ * delays and synapse models are taken from the files, sources and targets
+ * only select which of the stored connections are created. If the files
+ * were written by as many processes as are running now, each process only
+ * reads its own file, otherwise all processes read all files. All threads
+ * scan the memory-mapped records in parallel and create the connections
+ * to their local targets.
+ */
+class FromFileBuilder : public ConnBuilder
+{
+public:
+  FromFileBuilder( const GIDCollection&,
+    const GIDCollection&,
+    const DictionaryDatum&,
+    const DictionaryDatum& );
+
+  bool
+  requires_proxies() const
+  {
+    return false;
+  }
+
+protected:
+  void connect_();
+
+private:
+  //! Return true if gid is in the given collection, see sorted_sources_.
+  bool contains_( const GIDCollection&,
+    const std::vector< index >&,
+    index ) const;
+
+  void connect_file_( const MappedConnectomeFile& );
+
+  std::string prefix_; //!< prefix of the connectome file names
+
+  //! Sorted GIDs of sources and targets, only filled for non-ranges.
+  std::vector< index > sorted_sources_;
+  std::vector< index > sorted_targets_;
+};
+
 class SPBuilder : public ConnBuilder
 {
 public:
@@ -405,6 +502,20 @@ ConnBuilder::register_parameters_requiring_skipping_( ConnParameter& param )
   }
 }
 
+inline double
+ConnBuilder::weight_value_( thread tid, librandom::RngPtr& rng )
+{
+  return weight_blocks_ ? weight_blocks_->value_double( tid, rng )
+                        : weight_->value_double( tid, rng );
+}
+
+inline double
+ConnBuilder::delay_value_( thread tid, librandom::RngPtr& rng )
+{
+  return delay_blocks_ ? delay_blocks_->value_double( tid, rng )
+                       : delay_->value_double( tid, rng );
+}
+
 inline void
 ConnBuilder::skip_conn_parameter_( thread target_thread, size_t n_skip )
 {
@@ -24,6 +24,7 @@
 #define CONN_PARAMETER_H
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -77,6 +78,17 @@ public:
    */
   virtual double value_double( thread, librandom::RngPtr& ) const = 0;
   virtual long value_int( thread, librandom::RngPtr& ) const = 0;
+
+  /**
+   * Fill array with the next n parameter values.
+   *
+   * Equivalent to n calls of value_double(), but implemented more
+   * efficiently by most parameter types. Random parameters may deliver
+   * a different sequence of numbers than repeated calls to value_double().
+   */
+  virtual void values_double( thread, librandom::RngPtr&, double*, size_t )
+    const;
+
   virtual void
   skip( thread, size_t n_skip ) const
   {
@@ -136,6 +148,12 @@ public:
     return value_;
   }
 
+  void
+  values_double( thread, librandom::RngPtr&, double* values, size_t n ) const
+  {
+    std::fill( values, values + n, value_ );
+  }
+
   long
   value_int( thread, librandom::RngPtr& ) const
   {
@@ -184,6 +202,12 @@ public:
     return static_cast< double >( value_ );
   }
 
+  void
+  values_double( thread, librandom::RngPtr&, double* values, size_t n ) const
+  {
+    std::fill( values, values + n, static_cast< double >( value_ ) );
+  }
+
   long
   value_int( thread, librandom::RngPtr& ) const
   {
@@ -269,6 +293,20 @@ public:
     }
   }
 
+  void
+  values_double( thread tid,
+    librandom::RngPtr&,
+    double* values,
+    size_t n ) const
+  {
+    if ( static_cast< size_t >( values_->end() - next_[ tid ] ) < n )
+    {
+      throw KernelException( "Parameter values exhausted." );
+    }
+    std::copy( next_[ tid ], next_[ tid ] + n, values );
+    next_[ tid ] += n;
+  }
+
   long
   value_int( thread, librandom::RngPtr& ) const
   {
@@ -369,6 +407,20 @@ public:
     }
   }
 
+  void
+  values_double( thread tid,
+    librandom::RngPtr&,
+    double* values,
+    size_t n ) const
+  {
+    if ( static_cast< size_t >( values_->end() - next_[ tid ] ) < n )
+    {
+      throw KernelException( "Parameter values exhausted." );
+    }
+    std::copy( next_[ tid ], next_[ tid ] + n, values );
+    next_[ tid ] += n;
+  }
+
   inline bool
   is_array() const
   {
@@ -408,6 +460,15 @@ public:
     return ( *rdv_ )( rng );
   }
 
+  void
+  values_double( thread,
+    librandom::RngPtr& rng,
+    double* values,
+    size_t n ) const
+  {
+    rdv_->fill( rng, values, n );
+  }
+
   long
   value_int( thread, librandom::RngPtr& rng ) const
   {
@@ -424,6 +485,69 @@ private:
   librandom::RdvPtr rdv_;
 };
 
+inline void
+ConnParameter::values_double( thread tid,
+  librandom::RngPtr& rng,
+  double* values,
+  size_t n ) const
+{
+  for ( size_t i = 0; i < n; ++i )
+  {
+    values[ i ] = value_double( tid, rng );
+  }
+}
+
+/**
+ * Values of a ConnParameter drawn in blocks.
+ *
+ * Hands out the values of a parameter one by one, but obtains them from
+ * the parameter in blocks per thread by values_double(). This is only
+ * meaningful for random parameters, since values drawn ahead are
+ * discarded when the object is destroyed.
+ */
+class ConnParameterBlocks
+{
+public:
+  ConnParameterBlocks( const ConnParameter& param,
+    const size_t nthreads,
+    const size_t block_size = 256 )
+    : param_( param )
+    , block_size_( block_size )
+    , blocks_( nthreads )
+  {
+  }
+
+  double
+  value_double( thread tid, librandom::RngPtr& rng )
+  {
+    Block_& block = blocks_[ tid ];
+    if ( block.next_ == block.values_.size() )
+    {
+      block.values_.resize( block_size_ );
+      param_.values_double( tid, rng, &block.values_[ 0 ], block_size_ );
+      block.next_ = 0;
+    }
+    return block.values_[ block.next_++ ];
+  }
+
+private:
+  struct Block_
+  {
+    std::vector< double > values_;
+    size_t next_;
+
+    Block_()
+      : values_()
+      , next_( 0 )
+    {
+    }
+  };
+
+  const ConnParameter& param_;
+  const size_t block_size_; //!< number of values drawn at once
+  std::vector< Block_ > blocks_;
+};
+
 } // namespace nest
 
 #endif
@@ -23,11 +23,17 @@
 #ifndef CONNECTION_H
 #define CONNECTION_H
 
+// Includes from libnestutil:
+#include "compose.hpp"
+
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "common_synapse_properties.h"
 #include "connection_label.h"
+#include "connector_model.h"
 #include "delay_checker.h"
 #include "event.h"
+#include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_names.h"
 #include "nest_time.h"
@@ -149,6 +155,21 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Read a single property of this connection without a dictionary.
+   *
+   * Derived classes hide this function to give direct access to their own
+   * members and call the base class version for all other properties.
+   * @returns false if the property is not handled here.
+   */
+  bool get_property( const Name& name, double& value ) const;
+
+  /**
+   * Set a single property of this connection, see get_property().
+   * @returns false if the property is not handled here.
+   */
+  bool set_property( const Name& name, double value, ConnectorModel& cm );
+
   /**
    * Check syn_spec dictionary for parameters that are not allowed with the
    * given connection.
@@ -161,6 +182,24 @@ public:
    */
   void check_synapse_params( const DictionaryDatum& d ) const;
 
+  /**
+   * Store the state of the connection in a checkpoint.
+   *
+   * Connection types must opt in to checkpoints explicitly, since their
+   * members cannot be copied bytewise in general. They hide save_state()
+   * and restore_state() and store their own members after those stored by
+   * save_base_state_(). The versions of the base class throw
+   * NotImplemented.
+   * @see KernelManager::save_checkpoint()
+   */
+  void save_state( CheckpointWriter& ) const;
+
+  /**
+   * Restore the state stored by save_state(). The target is set when the
+   * connection is added to its connector.
+   */
+  void restore_state( CheckpointReader& );
+
   /**
    * Calibrate the delay of this connection to the desired resolution.
    */
@@ -247,6 +286,16 @@ public:
   }
 
 protected:
+  /**
+   * Store the delay and receiver port of the connection.
+   */
+  void save_base_state_( CheckpointWriter& ) const;
+
+  /**
+   * Restore the delay and receiver port stored by save_base_state_().
+   */
+  void restore_base_state_( CheckpointReader& );
+
   /**
    * This function calls check_connection() on the sender to check if the
    * receiver
@@ -316,6 +365,35 @@ Connection< targetidentifierT >::get_status( DictionaryDatum& d ) const
   target_.get_status( d );
 }
 
+template < typename targetidentifierT >
+inline bool
+Connection< targetidentifierT >::get_property( const Name& name,
+  double& value ) const
+{
+  if ( name == names::delay )
+  {
+    value = syn_id_delay_.get_delay_ms();
+    return true;
+  }
+  return false;
+}
+
+template < typename targetidentifierT >
+inline bool
+Connection< targetidentifierT >::set_property( const Name& name,
+  double value,
+  ConnectorModel& )
+{
+  if ( name == names::delay )
+  {
+    kernel().connection_manager.get_delay_checker().assert_valid_delay_ms(
+      value );
+    syn_id_delay_.set_delay_ms( value );
+    return true;
+  }
+  return false;
+}
+
 template < typename targetidentifierT >
 inline void
 Connection< targetidentifierT >::set_status( const DictionaryDatum& d,
@@ -338,6 +416,48 @@ Connection< targetidentifierT >::check_synapse_params(
 {
 }
 
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::save_state( CheckpointWriter& ) const
+{
+  const ConnectorModel& cm =
+    kernel().model_manager.get_synapse_prototype( get_syn_id() );
+  throw NotImplemented( String::compose(
+    "Synapse model %1 does not support checkpoints.", cm.get_name() ) );
+}
+
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::restore_state( CheckpointReader& )
+{
+  const ConnectorModel& cm =
+    kernel().model_manager.get_synapse_prototype( get_syn_id() );
+  throw NotImplemented( String::compose(
+    "Synapse model %1 does not support checkpoints.", cm.get_name() ) );
+}
+
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::save_base_state_(
+  CheckpointWriter& writer ) const
+{
+  writer.write< long >( syn_id_delay_.delay );
+  writer.write( target_.get_rport() );
+}
+
+template < typename targetidentifierT >
+inline void
+Connection< targetidentifierT >::restore_base_state_(
+  CheckpointReader& reader )
+{
+  long delay = 0;
+  rport rprt = 0;
+  reader.read( delay );
+  reader.read( rprt );
+  syn_id_delay_.delay = delay;
+  target_.set_rport( rprt );
+}
+
 template < typename targetidentifierT >
 inline void
 Connection< targetidentifierT >::calibrate( const TimeConverter& tc )
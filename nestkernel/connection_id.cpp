@@ -22,7 +22,13 @@
 
 #include "connection_id.h"
 
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+
 // Includes from nestkernel:
+#include "exceptions.h"
+#include "nest_datums.h"
 #include "nest_names.h"
 
 // Includes from sli:
@@ -100,4 +106,108 @@ ConnectionID::print_me( std::ostream& out ) const
       << "," << synapse_modelid_ << "," << port_ << ">";
 }
 
+ConnectionArrays::ConnectionArrays()
+  : source_gid_()
+  , target_gid_()
+  , target_thread_()
+  , synapse_modelid_()
+  , port_()
+{
+}
+
+ConnectionArrays::ConnectionArrays( const DictionaryDatum& d )
+  : source_gid_( getValue< std::vector< long > >( d, names::source ) )
+  , target_gid_( getValue< std::vector< long > >( d, names::target ) )
+  , target_thread_(
+      getValue< std::vector< long > >( d, names::target_thread ) )
+  , synapse_modelid_(
+      getValue< std::vector< long > >( d, names::synapse_modelid ) )
+  , port_( getValue< std::vector< long > >( d, names::port ) )
+{
+  const size_t n = source_gid_.size();
+  if ( target_gid_.size() != n or target_thread_.size() != n
+    or synapse_modelid_.size() != n or port_.size() != n )
+  {
+    throw BadProperty( "All connection arrays must have the same length." );
+  }
+}
+
+ConnectionArrays::ConnectionArrays( const ArrayDatum& conns )
+{
+  source_gid_.reserve( conns.size() );
+  target_gid_.reserve( conns.size() );
+  target_thread_.reserve( conns.size() );
+  synapse_modelid_.reserve( conns.size() );
+  port_.reserve( conns.size() );
+  for ( size_t i = 0; i < conns.size(); ++i )
+  {
+    const ConnectionDatum conn = getValue< ConnectionDatum >( conns.get( i ) );
+    push_back( conn.get_source_gid(),
+      conn.get_target_gid(),
+      conn.get_target_thread(),
+      conn.get_synapse_model_id(),
+      conn.get_port() );
+  }
+}
+
+void
+ConnectionArrays::resize( size_t n )
+{
+  source_gid_.resize( n );
+  target_gid_.resize( n );
+  target_thread_.resize( n );
+  synapse_modelid_.resize( n );
+  port_.resize( n );
+}
+
+void
+ConnectionArrays::clear()
+{
+  std::vector< long >().swap( source_gid_ );
+  std::vector< long >().swap( target_gid_ );
+  std::vector< long >().swap( target_thread_ );
+  std::vector< long >().swap( synapse_modelid_ );
+  std::vector< long >().swap( port_ );
+}
+
+void
+ConnectionArrays::assign( size_t offset, const ConnectionArrays& other )
+{
+  assert( offset + other.size() <= size() );
+  std::copy( other.source_gid_.begin(),
+    other.source_gid_.end(),
+    source_gid_.begin() + offset );
+  std::copy( other.target_gid_.begin(),
+    other.target_gid_.end(),
+    target_gid_.begin() + offset );
+  std::copy( other.target_thread_.begin(),
+    other.target_thread_.end(),
+    target_thread_.begin() + offset );
+  std::copy( other.synapse_modelid_.begin(),
+    other.synapse_modelid_.end(),
+    synapse_modelid_.begin() + offset );
+  std::copy( other.port_.begin(), other.port_.end(), port_.begin() + offset );
+}
+
+//! Move the contents of column to a new IntVectorDatum.
+static Token
+release_column( std::vector< long >& column )
+{
+  std::vector< long >* data = new std::vector< long >();
+  data->swap( column );
+  return Token( new IntVectorDatum( data ) );
+}
+
+DictionaryDatum
+ConnectionArrays::release_as_dict()
+{
+  DictionaryDatum dict( new Dictionary );
+  ( *dict )[ names::source ] = release_column( source_gid_ );
+  ( *dict )[ names::target ] = release_column( target_gid_ );
+  ( *dict )[ names::target_thread ] = release_column( target_thread_ );
+  ( *dict )[ names::synapse_modelid ] = release_column( synapse_modelid_ );
+  ( *dict )[ names::port ] = release_column( port_ );
+  return dict;
+}
+
 } // namespace
@@ -23,6 +23,9 @@
 #ifndef CONNECTION_ID_H
 #define CONNECTION_ID_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from sli:
 #include "arraydatum.h"
 #include "dictutils.h"
@@ -65,6 +68,60 @@ protected:
   long port_;
 };
 
+/**
+ * Connection identifiers stored column by column, so that many connections
+ * can be collected and handed out without creating a ConnectionID object
+ * for each of them. Entry i of all columns describes connection i.
+ */
+class ConnectionArrays
+{
+public:
+  ConnectionArrays();
+
+  /**
+   * Read the columns from a dictionary as returned by release_as_dict().
+   * @throws BadProperty if the columns differ in length.
+   */
+  explicit ConnectionArrays( const DictionaryDatum& d );
+
+  /**
+   * Read an array of connection objects as returned by GetConnections.
+   */
+  explicit ConnectionArrays( const ArrayDatum& conns );
+
+  size_t size() const;
+
+  void push_back( long source_gid,
+    long target_gid,
+    long target_thread,
+    long synapse_modelid,
+    long port );
+
+  void resize( size_t n );
+
+  //! Remove all connections and free the memory of the columns.
+  void clear();
+
+  /**
+   * Copy all connections of other to positions offset, offset + 1, ...
+   */
+  void assign( size_t offset, const ConnectionArrays& other );
+
+  ConnectionID get_connection_id( size_t i ) const;
+
+  /**
+   * Return a dictionary with one IntVectorDatum per column. The columns
+   * are moved to the dictionary, so that the arrays are empty afterwards.
+   */
+  DictionaryDatum release_as_dict();
+
+  std::vector< long > source_gid_;
+  std::vector< long > target_gid_;
+  std::vector< long > target_thread_;
+  std::vector< long > synapse_modelid_;
+  std::vector< long > port_;
+};
+
 inline ConnectionID::ConnectionID( const ConnectionID& cid )
   : source_gid_( cid.source_gid_ )
   , target_gid_( cid.target_gid_ )
@@ -104,6 +161,36 @@ ConnectionID::get_port() const
   return port_;
 }
 
+inline size_t
+ConnectionArrays::size() const
+{
+  return source_gid_.size();
+}
+
+inline void
+ConnectionArrays::push_back( long source_gid,
+  long target_gid,
+  long target_thread,
+  long synapse_modelid,
+  long port )
+{
+  source_gid_.push_back( source_gid );
+  target_gid_.push_back( target_gid );
+  target_thread_.push_back( target_thread );
+  synapse_modelid_.push_back( synapse_modelid );
+  port_.push_back( port );
+}
+
+inline ConnectionID
+ConnectionArrays::get_connection_id( size_t i ) const
+{
+  return ConnectionID( source_gid_[ i ],
+    target_gid_[ i ],
+    target_thread_[ i ],
+    synapse_modelid_[ i ],
+    port_[ i ] );
+}
+
 } // namespace
 
 #endif /* #ifndef CONNECTION_ID_H */
@@ -26,6 +26,7 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <set>
@@ -34,11 +35,14 @@
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
+#include "numerics.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "conn_builder.h"
 #include "conn_builder_factory.h"
 #include "connection_label.h"
+#include "connectome_file.h"
 #include "connector_base.h"
 #include "connector_model.h"
 #include "delay_checker.h"
@@ -99,6 +103,10 @@ nest::ConnectionManager::initialize()
   tVVCounter tmp3( kernel().vp_manager.get_num_threads(), tVCounter() );
   vv_num_connections_.swap( tmp3 );
 
+  std::vector< StagedConnections > tmp4(
+    kernel().vp_manager.get_num_threads() );
+  staged_connections_.swap( tmp4 );
+
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
   min_delay_ = max_delay_ = 1;
@@ -125,6 +133,7 @@ void
 nest::ConnectionManager::finalize()
 {
   delete_connections_();
+  staged_connections_.clear();
 }
 
 void
@@ -442,6 +451,98 @@ nest::ConnectionManager::connect( index sgid,
   }
 }
 
+void
+nest::ConnectionManager::stage_connection( index sgid,
+  Node* target,
+  thread target_thread,
+  index syn,
+  double d,
+  double w )
+{
+  if ( not target->has_proxies() )
+  {
+    // keep connections of a source in the order in which they were made
+    flush_staged_connections( target_thread, false );
+    connect( sgid, target, target_thread, syn, d, w );
+    return;
+  }
+
+  assert( target_thread == kernel().vp_manager.get_thread_id() );
+  StagedConnections& staged = staged_connections_[ target_thread ];
+  staged.push_back( StagedConnection( sgid, target, syn, d, w ) );
+
+  // bound the memory needed for staging
+  if ( staged.size() >= ( 1 << 20 ) )
+  {
+    flush_staged_connections( target_thread, false );
+  }
+}
+
+void
+nest::ConnectionManager::flush_staged_connections( thread tid,
+  bool exact_capacity )
+{
+  StagedConnections& staged = staged_connections_[ tid ];
+  if ( staged.empty() )
+  {
+    return;
+  }
+
+  // group connections by source, stable sorting preserves the order of
+  // connections of the same source
+  std::stable_sort( staged.begin(), staged.end() );
+
+  StagedConnections::const_iterator first = staged.begin();
+  while ( first != staged.end() )
+  {
+    const index sgid = first->sgid_;
+    const synindex syn_id = first->syn_id_;
+    StagedConnections::const_iterator last = first + 1;
+    while ( last != staged.end() and last->sgid_ == sgid
+      and last->syn_id_ == syn_id )
+    {
+      ++last;
+    }
+
+    Node* source = kernel().node_manager.get_node( sgid, tid );
+    ConnectorBase* conn = validate_source_entry_( tid, sgid, syn_id );
+    if ( vv_num_connections_[ tid ].size() <= syn_id )
+    {
+      vv_num_connections_[ tid ].resize( syn_id + 1 );
+    }
+
+    const StagedConnections::const_iterator group_begin = first;
+    try
+    {
+      kernel()
+        .model_manager.get_synapse_prototype( syn_id, tid )
+        .add_connections( *source, conn, syn_id, first, last, exact_capacity );
+    }
+    catch ( ... )
+    {
+      if ( conn != 0 )
+      {
+        connections_[ tid ].set( sgid, conn );
+      }
+      vv_num_connections_[ tid ][ syn_id ] += first - group_begin;
+      staged.clear();
+      throw;
+    }
+    connections_[ tid ].set( sgid, conn );
+    vv_num_connections_[ tid ][ syn_id ] += last - group_begin;
+  }
+
+  if ( exact_capacity )
+  {
+    // last flush of a connection call, release the staging buffer
+    StagedConnections().swap( staged );
+  }
+  else
+  {
+    staged.clear();
+  }
+}
+
 // gid node thread syn dict delay weight
 void
 nest::ConnectionManager::connect( index sgid,
@@ -688,8 +789,10 @@ nest::ConnectionManager::disconnect( Node& target,
       throw InexistentConnection();
     }
     DictionaryDatum data = DictionaryDatum( new Dictionary );
-    def< index >( data, names::target, target.get_gid() );
-    def< index >( data, names::source, sgid );
+    ( *data )[ names::target ] =
+      new IntVectorDatum( new std::vector< long >( 1, target.get_gid() ) );
+    ( *data )[ names::source ] =
+      new IntVectorDatum( new std::vector< long >( 1, sgid ) );
     ArrayDatum conns = kernel().connection_manager.get_connections( data );
     if ( conns.numReferences() == 0 )
     {
@@ -1088,231 +1191,511 @@ nest::ConnectionManager::get_num_connections( synindex syn_id ) const
   return num_connections;
 }
 
-ArrayDatum
-nest::ConnectionManager::get_connections( DictionaryDatum params ) const
+void
+nest::ConnectionManager::assert_valid_connection_(
+  const ConnectionArrays& connections,
+  size_t i ) const
 {
-  std::deque< ConnectionID > connectome;
-
-  const Token& source_t = params->lookup( names::source );
-  const Token& target_t = params->lookup( names::target );
-  const Token& syn_model_t = params->lookup( names::synapse_model );
-  const TokenArray* source_a = 0;
-  const TokenArray* target_a = 0;
-  long synapse_label = UNLABELED_CONNECTION;
-  updateValue< long >( params, names::synapse_label, synapse_label );
-
-  if ( not source_t.empty() )
+  const long tid = connections.target_thread_[ i ];
+  const long sgid = connections.source_gid_[ i ];
+  if ( tid < 0
+    or static_cast< size_t >( tid ) >= kernel().vp_manager.get_num_threads()
+    or sgid < 0 or static_cast< size_t >( sgid ) >= connections_[ tid ].size()
+    or connections_[ tid ].get( sgid ) == 0 )
   {
-    source_a = dynamic_cast< TokenArray const* >( source_t.datum() );
+    throw InexistentConnection();
   }
-  if ( not target_t.empty() )
+  const long syn_id = connections.synapse_modelid_[ i ];
+  if ( syn_id < 0 or static_cast< size_t >( syn_id )
+      >= kernel().model_manager.get_num_synapse_prototypes() )
   {
-    target_a = dynamic_cast< TokenArray const* >( target_t.datum() );
+    throw UnknownSynapseType( syn_id );
   }
+}
 
-  size_t syn_id = 0;
+void
+nest::ConnectionManager::get_synapse_property(
+  const ConnectionArrays& connections,
+  const Name& name,
+  std::vector< double >& values ) const
+{
+  const size_t n = connections.size();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    assert_valid_connection_( connections, i );
+  }
+  values.assign( n, numerics::nan );
+
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
+    num_threads );
+  // connections whose property must be read from the status dictionary
+  std::vector< std::vector< size_t > > deferred( num_threads );
 
 #ifdef _OPENMP
-  std::string msg;
-  msg = String::compose( "Setting OpenMP num_threads to %1.",
-    kernel().vp_manager.get_num_threads() );
-  LOG( M_DEBUG, "ConnectionManager::get_connections", msg );
-  omp_set_num_threads( kernel().vp_manager.get_num_threads() );
+#pragma omp parallel
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
+#else
+  for ( thread t = 0; t < num_threads; ++t )
+  {
 #endif
+    try
+    {
+      for ( size_t i = 0; i < n; ++i )
+      {
+        if ( connections.target_thread_[ i ] != t )
+        {
+          continue;
+        }
+        ConnectorBase* conn = validate_pointer(
+          connections_[ t ].get( connections.source_gid_[ i ] ) );
+        if ( not conn->get_synapse_property( connections.synapse_modelid_[ i ],
+               connections.port_[ i ],
+               name,
+               values[ i ],
+               false ) )
+        {
+          deferred[ t ].push_back( i );
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      exceptions_raised.at( t ) = lockPTR< WrappedThreadException >(
+        new WrappedThreadException( err ) );
+    }
+  }
 
-  // First we check, whether a synapse model is given.
-  // If not, we will iterate all.
-  if ( not syn_model_t.empty() )
+  for ( thread t = 0; t < num_threads; ++t )
   {
-    Name synmodel_name = getValue< Name >( syn_model_t );
-    const Token synmodel =
-      kernel().model_manager.get_synapsedict()->lookup( synmodel_name );
-    if ( not synmodel.empty() )
+    if ( exceptions_raised.at( t ).valid() )
     {
-      syn_id = static_cast< size_t >( synmodel );
+      throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
     }
-    else
+  }
+
+  // Status dictionaries allocate Datums from pools that are not
+  // thread-safe, so they are only used serially.
+  for ( thread t = 0; t < num_threads; ++t )
+  {
+    for ( size_t j = 0; j < deferred[ t ].size(); ++j )
     {
-      throw UnknownModelName( synmodel_name.toString() );
+      const size_t i = deferred[ t ][ j ];
+      validate_pointer( connections_[ t ].get( connections.source_gid_[ i ] ) )
+        ->get_synapse_property( connections.synapse_modelid_[ i ],
+          connections.port_[ i ],
+          name,
+          values[ i ],
+          true );
     }
-    get_connections( connectome, source_a, target_a, syn_id, synapse_label );
   }
-  else
+}
+
+void
+nest::ConnectionManager::set_synapse_property(
+  const ConnectionArrays& connections,
+  const Name& name,
+  const std::vector< double >& values )
+{
+  const size_t n = connections.size();
+  if ( values.size() != 1 and values.size() != n )
   {
-    for ( syn_id = 0;
-          syn_id < kernel().model_manager.get_num_synapse_prototypes();
-          ++syn_id )
+    throw BadProperty(
+      "One value per connection or a single value must be given." );
+  }
+  for ( size_t i = 0; i < n; ++i )
+  {
+    assert_valid_connection_( connections, i );
+  }
+
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
+    num_threads );
+  // connections whose property must be set through the status dictionary
+  std::vector< std::vector< size_t > > deferred( num_threads );
+
+#ifdef _OPENMP
+#pragma omp parallel
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
+#else
+  for ( thread t = 0; t < num_threads; ++t )
+  {
+#endif
+    try
     {
-      get_connections( connectome, source_a, target_a, syn_id, synapse_label );
+      for ( size_t i = 0; i < n; ++i )
+      {
+        if ( connections.target_thread_[ i ] != t )
+        {
+          continue;
+        }
+        const synindex syn_id = connections.synapse_modelid_[ i ];
+        ConnectorBase* conn = validate_pointer(
+          connections_[ t ].get( connections.source_gid_[ i ] ) );
+        if ( not conn->set_synapse_property( syn_id,
+               kernel().model_manager.get_synapse_prototype( syn_id, t ),
+               connections.port_[ i ],
+               name,
+               values.size() == 1 ? values[ 0 ] : values[ i ],
+               false ) )
+        {
+          deferred[ t ].push_back( i );
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      exceptions_raised.at( t ) = lockPTR< WrappedThreadException >(
+        new WrappedThreadException( err ) );
     }
   }
 
-  ArrayDatum result;
-  result.reserve( connectome.size() );
-
-  while ( not connectome.empty() )
+  for ( thread t = 0; t < num_threads; ++t )
   {
-    result.push_back( ConnectionDatum( connectome.front() ) );
-    connectome.pop_front();
+    if ( exceptions_raised.at( t ).valid() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
+    }
   }
 
-  return result;
+  // Status dictionaries allocate Datums from pools that are not
+  // thread-safe, so they are only used serially.
+  for ( thread t = 0; t < num_threads; ++t )
+  {
+    for ( size_t j = 0; j < deferred[ t ].size(); ++j )
+    {
+      const size_t i = deferred[ t ][ j ];
+      const synindex syn_id = connections.synapse_modelid_[ i ];
+      validate_pointer( connections_[ t ].get( connections.source_gid_[ i ] ) )
+        ->set_synapse_property( syn_id,
+          kernel().model_manager.get_synapse_prototype( syn_id, t ),
+          connections.port_[ i ],
+          name,
+          values.size() == 1 ? values[ 0 ] : values[ i ],
+          true );
+    }
+  }
 }
 
-// Helper method, implemented as operator<<(), that removes ConnectionIDs from
-// input deque and appends them to output deque.
-static inline std::deque< nest::ConnectionID >&
-extend_connectome( std::deque< nest::ConnectionID >& out,
-  std::deque< nest::ConnectionID >& in )
+ArrayDatum
+nest::ConnectionManager::get_connections( DictionaryDatum params ) const
 {
-  while ( not in.empty() )
+  ConnectionArrays connections;
+  get_connections( connections, params );
+
+  ArrayDatum result;
+  result.reserve( connections.size() );
+  for ( size_t i = 0; i < connections.size(); ++i )
   {
-    out.push_back( in.front() );
-    in.pop_front();
+    result.push_back( ConnectionDatum( connections.get_connection_id( i ) ) );
   }
 
-  return out;
+  return result;
 }
 
-void
-nest::ConnectionManager::get_connections(
-  std::deque< ConnectionID >& connectome,
-  TokenArray const* source,
-  TokenArray const* target,
-  size_t syn_id,
-  long synapse_label ) const
+//! Read a gid array from the dictionary, return sorted gids without
+//! duplicates.
+static bool
+get_sorted_gids( const DictionaryDatum& params,
+  const Name& name,
+  std::vector< nest::index >& gids )
 {
-  if ( get_num_connections( syn_id ) == 0 )
+  std::vector< long > values;
+  if ( not updateValue< std::vector< long > >( params, name, values ) )
   {
-    return;
+    return false;
   }
+  gids.assign( values.begin(), values.end() );
+  std::sort( gids.begin(), gids.end() );
+  gids.erase( std::unique( gids.begin(), gids.end() ), gids.end() );
+  return true;
+}
+
+void
+nest::ConnectionManager::get_connections( ConnectionArrays& connections,
+  const DictionaryDatum& params ) const
+{
+  std::vector< index > sources;
+  std::vector< index > targets;
+  const bool have_sources = get_sorted_gids( params, names::source, sources );
+  const bool have_targets = get_sorted_gids( params, names::target, targets );
+  long synapse_label = UNLABELED_CONNECTION;
+  updateValue< long >( params, names::synapse_label, synapse_label );
 
-  if ( source == 0 and target == 0 )
+  // If no synapse model is given, we collect all.
+  std::vector< synindex > syn_ids;
+  const Token& syn_model_t = params->lookup( names::synapse_model );
+  if ( not syn_model_t.empty() )
   {
-#ifdef _OPENMP
-#pragma omp parallel
+    Name synmodel_name = getValue< Name >( syn_model_t );
+    const Token synmodel =
+      kernel().model_manager.get_synapsedict()->lookup( synmodel_name );
+    if ( synmodel.empty() )
     {
-      thread t = kernel().vp_manager.get_thread_id();
-#else
-    for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+      throw UnknownModelName( synmodel_name.toString() );
+    }
+    syn_ids.push_back( static_cast< size_t >( synmodel ) );
+  }
+  else
+  {
+    for ( synindex syn_id = 0;
+          syn_id < kernel().model_manager.get_num_synapse_prototypes();
+          ++syn_id )
     {
-#endif
-      std::deque< ConnectionID > conns_in_thread;
+      syn_ids.push_back( syn_id );
+    }
+  }
 
-      for ( index source_id = 1; source_id < connections_[ t ].size();
-            ++source_id )
-      {
-        if ( connections_[ t ].get( source_id ) != 0 )
-        {
-          validate_pointer( connections_[ t ].get( source_id ) )
-            ->get_connections(
-              source_id, t, syn_id, synapse_label, conns_in_thread );
-        }
-      }
-      if ( conns_in_thread.size() > 0 )
-      {
+  const thread num_threads = kernel().vp_manager.get_num_threads();
 #ifdef _OPENMP
-#pragma omp critical( get_connections )
+  LOG( M_DEBUG,
+    "ConnectionManager::get_connections",
+    String::compose( "Setting OpenMP num_threads to %1.", num_threads ) );
+  omp_set_num_threads( num_threads );
 #endif
-        extend_connectome( connectome, conns_in_thread );
-      }
-    }
 
-    return;
-  }
-  else if ( source == 0 and target != 0 )
-  {
+  // Each thread collects the connections of its sources per synapse type,
+  // so that no synchronization is needed while collecting.
+  std::vector< std::vector< ConnectionArrays > > found(
+    syn_ids.size(), std::vector< ConnectionArrays >( num_threads ) );
+
 #ifdef _OPENMP
 #pragma omp parallel
-    {
-      thread t = kernel().vp_manager.get_thread_id();
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
 #else
-    for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
-    {
+  for ( thread t = 0; t < num_threads; ++t )
+  {
 #endif
-      std::deque< ConnectionID > conns_in_thread;
+    const std::vector< index >* target_filter = have_targets ? &targets : 0;
+    for ( size_t k = 0; k < syn_ids.size(); ++k )
+    {
+      const synindex syn_id = syn_ids[ k ];
+      if ( syn_id >= vv_num_connections_[ t ].size()
+        or vv_num_connections_[ t ][ syn_id ] == 0 )
+      {
+        continue;
+      }
 
-      for ( index source_id = 1; source_id < connections_[ t ].size();
-            ++source_id )
+      ConnectionArrays& conns = found[ k ][ t ];
+      if ( have_sources )
       {
-        if ( validate_pointer( connections_[ t ].get( source_id ) ) != 0 )
+        for ( size_t s = 0; s < sources.size(); ++s )
         {
-          for ( index t_id = 0; t_id < target->size(); ++t_id )
+          const index source_id = sources[ s ];
+          if ( source_id < connections_[ t ].size()
+            and connections_[ t ].get( source_id ) != 0 )
           {
-            size_t target_id = target->get( t_id );
             validate_pointer( connections_[ t ].get( source_id ) )
-              ->get_connections( source_id,
-                target_id,
-                t,
-                syn_id,
-                synapse_label,
-                conns_in_thread );
+              ->get_connection_arrays(
+                source_id, t, syn_id, synapse_label, target_filter, conns );
           }
         }
       }
-      if ( conns_in_thread.size() > 0 )
+      else
       {
-#ifdef _OPENMP
-#pragma omp critical( get_connections )
-#endif
-        extend_connectome( connectome, conns_in_thread );
+        for ( tSConnector::const_nonempty_iterator it =
+                connections_[ t ].nonempty_begin();
+              it != connections_[ t ].nonempty_end();
+              ++it )
+        {
+          validate_pointer( *it )->get_connection_arrays(
+            connections_[ t ].get_pos( it ),
+            t,
+            syn_id,
+            synapse_label,
+            target_filter,
+            conns );
+        }
       }
     }
-    return;
   }
-  else if ( source != 0 )
+
+  // concatenate the results by synapse type and thread
+  std::vector< std::vector< size_t > > offsets(
+    syn_ids.size(), std::vector< size_t >( num_threads ) );
+  size_t num_connections = 0;
+  for ( size_t k = 0; k < syn_ids.size(); ++k )
   {
+    for ( thread t = 0; t < num_threads; ++t )
+    {
+      offsets[ k ][ t ] = num_connections;
+      num_connections += found[ k ][ t ].size();
+    }
+  }
+  connections.resize( num_connections );
+
 #ifdef _OPENMP
 #pragma omp parallel
-    {
-      size_t t = kernel().vp_manager.get_thread_id();
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
 #else
-    for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
-    {
+  for ( thread t = 0; t < num_threads; ++t )
+  {
 #endif
-      std::deque< ConnectionID > conns_in_thread;
+    for ( size_t k = 0; k < syn_ids.size(); ++k )
+    {
+      connections.assign( offsets[ k ][ t ], found[ k ][ t ] );
+      found[ k ][ t ].clear();
+    }
+  }
+}
+
+void
+nest::ConnectionManager::dump_connectome( const std::string& prefix,
+  DictionaryDatum params ) const
+{
+  ConnectionArrays connectome;
+  get_connections( connectome, params );
+
+  std::vector< std::string > models(
+    kernel().model_manager.get_num_synapse_prototypes() );
+  for ( synindex syn_id = 0; syn_id < models.size(); ++syn_id )
+  {
+    models[ syn_id ] =
+      kernel().model_manager.get_synapse_prototype( syn_id ).get_name();
+  }
+
+  // Synapse models with homogeneous weights have no weight per
+  // connection. Whether a model has one is read from the status of its
+  // first connection; the weights of all other connections are read
+  // column-wise together with the delays.
+  std::vector< int > has_weight( models.size(), -1 );
+  ConnectionArrays weighted;
+  std::vector< size_t > weighted_index;
+  for ( size_t i = 0; i < connectome.size(); ++i )
+  {
+    const synindex syn_id = connectome.synapse_modelid_[ i ];
+    if ( has_weight[ syn_id ] < 0 )
+    {
+      const thread tid = connectome.target_thread_[ i ];
+      DictionaryDatum d( new Dictionary );
+      validate_pointer( connections_[ tid ].get( connectome.source_gid_[ i ] ) )
+        ->get_synapse_status( syn_id, d, connectome.port_[ i ], tid );
+      has_weight[ syn_id ] = d->known( names::weight );
+    }
+    if ( has_weight[ syn_id ] )
+    {
+      weighted.push_back( connectome.source_gid_[ i ],
+        connectome.target_gid_[ i ],
+        connectome.target_thread_[ i ],
+        syn_id,
+        connectome.port_[ i ] );
+      weighted_index.push_back( i );
+    }
+  }
+
+  std::vector< double > weights;
+  std::vector< double > delays;
+  get_synapse_property( weighted, names::weight, weights );
+  get_synapse_property( connectome, names::delay, delays );
+
+  std::vector< ConnectomeRecord > records( connectome.size() );
+  for ( size_t i = 0; i < records.size(); ++i )
+  {
+    ConnectomeRecord& record = records[ i ];
+    record.source_ = connectome.source_gid_[ i ];
+    record.target_ = connectome.target_gid_[ i ];
+    record.weight_ = numerics::nan;
+    record.delay_ = delays[ i ];
+    record.model_ = connectome.synapse_modelid_[ i ];
+    record.reserved_ = 0;
+  }
+  for ( size_t j = 0; j < weighted_index.size(); ++j )
+  {
+    records[ weighted_index[ j ] ].weight_ = weights[ j ];
+  }
+
+  write_connectome_file(
+    connectome_file_name( prefix, kernel().mpi_manager.get_rank() ),
+    kernel().mpi_manager.get_num_processes(),
+    kernel().mpi_manager.get_rank(),
+    models,
+    records );
+}
+
+void
+nest::ConnectionManager::save_connections( CheckpointWriter& writer ) const
+{
+  writer.write( min_delay_ );
+  writer.write( max_delay_ );
+
+  // for each thread, the connectors of all sources, each terminated by
+  // invalid_synindex, followed by gid 0
+  for ( thread t = 0;
+        t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
+        ++t )
+  {
+    for ( index source_id = 1; source_id < connections_[ t ].size();
+          ++source_id )
+    {
+      if ( connections_[ t ].get( source_id ) != 0 )
+      {
+        writer.write( source_id );
+        validate_pointer( connections_[ t ].get( source_id ) )
+          ->save_connections( writer, t );
+        writer.write( invalid_synindex );
+      }
+    }
+    writer.write< index >( 0 );
+  }
+}
 
-      for ( index s = 0; s < source->size(); ++s )
+void
+nest::ConnectionManager::restore_connections( CheckpointReader& reader )
+{
+  delay min_delay = 0;
+  delay max_delay = 0;
+  reader.read( min_delay );
+  reader.read( max_delay );
+
+  for ( thread t = 0;
+        t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
+        ++t )
+  {
+    index sgid = 0;
+    reader.read( sgid );
+    while ( sgid != 0 )
+    {
+      Node* source = kernel().node_manager.get_node( sgid, t );
+      synindex syn_id = invalid_synindex;
+      reader.read( syn_id );
+      while ( syn_id != invalid_synindex )
       {
-        size_t source_id = source->get( s );
-        if ( source_id < connections_[ t ].size()
-          && validate_pointer( connections_[ t ].get( source_id ) ) != 0 )
+        // throws UnknownSynapseType for invalid syn_id
+        ConnectorBase* conn = validate_source_entry_( t, sgid, syn_id );
+        if ( vv_num_connections_[ t ].size() <= syn_id )
         {
-          if ( target == 0 )
-          {
-            validate_pointer( connections_[ t ].get( source_id ) )
-              ->get_connections(
-                source_id, t, syn_id, synapse_label, conns_in_thread );
-          }
-          else
-          {
-            for ( index t_id = 0; t_id < target->size(); ++t_id )
-            {
-              size_t target_id = target->get( t_id );
-              validate_pointer( connections_[ t ].get( source_id ) )
-                ->get_connections( source_id,
-                  target_id,
-                  t,
-                  syn_id,
-                  synapse_label,
-                  conns_in_thread );
-            }
-          }
+          vv_num_connections_[ t ].resize( syn_id + 1 );
         }
-      }
+        const size_t before = conn == 0
+          ? 0
+          : validate_pointer( conn )->get_num_connections( syn_id );
 
-      if ( conns_in_thread.size() > 0 )
-      {
-#ifdef _OPENMP
-#pragma omp critical( get_connections )
-#endif
-        extend_connectome( connectome, conns_in_thread );
+        kernel()
+          .model_manager.get_synapse_prototype( syn_id, t )
+          .restore_connections( *source, conn, syn_id, t, reader );
+
+        if ( conn != 0 )
+        {
+          connections_[ t ].set( sgid, conn );
+          vv_num_connections_[ t ][ syn_id ] +=
+            validate_pointer( conn )->get_num_connections( syn_id ) - before;
+        }
+        reader.read( syn_id );
       }
+      reader.read( sgid );
     }
-    return;
-  } // else
-}
+  }
 
+  update_delay_extrema_();
+  if ( min_delay_ != min_delay or max_delay_ != max_delay )
+  {
+    throw BadProperty( "The delay extrema differ from the checkpoint." );
+  }
+}
 
 void
 nest::ConnectionManager::get_sources( std::vector< index > targets,
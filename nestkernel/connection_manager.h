@@ -38,6 +38,7 @@
 #include "nest_time.h"
 #include "nest_timeconverter.h"
 #include "nest_types.h"
+#include "staged_connection.h"
 
 // Includes from sli:
 #include "arraydatum.h"
@@ -46,6 +47,8 @@
 
 namespace nest
 {
+class CheckpointReader;
+class CheckpointWriter;
 class ConnectorBase;
 class GenericConnBuilderFactory;
 class spikecounter;
@@ -154,6 +157,33 @@ public:
     double d = numerics::nan,
     double w = numerics::nan );
 
+  /**
+   * Connect two nodes like connect(), but defer the creation of connections
+   * to targets with proxies until flush_staged_connections() is called for
+   * the target thread. All connections staged for a source are then added
+   * in one go, so that its connector is allocated only once.
+   *
+   * Staged connections are only visible after flushing, and errors in
+   * staged connections are only reported by flush_staged_connections().
+   * Connections to devices are created immediately. Must be called from
+   * the thread of the target.
+   */
+  void stage_connection( index s,
+    Node* target,
+    thread target_thread,
+    index syn,
+    double d = numerics::nan,
+    double w = numerics::nan );
+
+  /**
+   * Create all connections staged on thread tid.
+   * Must be called by thread tid. If an exception is thrown, connections
+   * staged after the failing one are discarded.
+   * \param exact_capacity If false, connectors may keep room for
+   * additional connections.
+   */
+  void flush_staged_connections( thread tid, bool exact_capacity = true );
+
   /**
    * Connect two nodes. The source node is defined by its global ID.
    * The target node is defined by the node. The connection is
@@ -205,12 +235,31 @@ public:
     thread tid,
     const DictionaryDatum& d );
 
+  /**
+   * Read one property of each of the given connections into values,
+   * without creating a status dictionary per connection. The connections
+   * are processed thread-parallel, each thread handling its own targets.
+   * Properties that are only accessible through the status dictionary are
+   * handled serially afterwards.
+   */
+  void get_synapse_property( const ConnectionArrays& connections,
+    const Name& name,
+    std::vector< double >& values ) const;
+
+  /**
+   * Set one property of each of the given connections. values contains
+   * one value per connection or a single value for all connections.
+   */
+  void set_synapse_property( const ConnectionArrays& connections,
+    const Name& name,
+    const std::vector< double >& values );
+
 
   /**
    * Return connections between pairs of neurons.
    * The params dictionary can have the following entries:
-   * 'source' a token array with GIDs of source neurons.
-   * 'target' a token array with GIDs of target neuron.
+   * 'source' an array or int vector with GIDs of source neurons.
+   * 'target' an array or int vector with GIDs of target neuron.
    * If either of these does not exist, all neuron are used for the respective
    * entry.
    * 'synapse_model' name of the synapse model, or all synapse models are
@@ -222,11 +271,35 @@ public:
    */
   ArrayDatum get_connections( DictionaryDatum dict ) const;
 
-  void get_connections( std::deque< ConnectionID >& connectome,
-    TokenArray const* source,
-    TokenArray const* target,
-    size_t syn_id,
-    long synapse_label ) const;
+  /**
+   * Collect the connections selected by params, see above, in columnar
+   * form. All threads collect the connections of their sources in
+   * parallel. Connections are ordered by synapse type, thread and source.
+   */
+  void get_connections( ConnectionArrays& connections,
+    const DictionaryDatum& params ) const;
+
+  /**
+   * Write the connections selected by params to a binary connectome file.
+   * params is interpreted as in get_connections(). Each process writes the
+   * connections to its local targets to the file
+   * connectome_file_name( prefix, rank ), see connectome_file.h.
+   * @throws IOError if the file cannot be written.
+   */
+  void dump_connectome( const std::string& prefix,
+    DictionaryDatum params ) const;
+
+  /**
+   * Store all local connections in a checkpoint.
+   */
+  void save_connections( CheckpointWriter& writer ) const;
+
+  /**
+   * Restore the connections stored by save_connections() and update the
+   * delay extrema.
+   * @throws BadProperty if the delay extrema differ from the checkpoint.
+   */
+  void restore_connections( CheckpointReader& reader );
 
   /**
    * Returns the number of connections in the network.
@@ -295,6 +368,13 @@ public:
   DelayChecker& get_delay_checker();
 
 private:
+  /**
+   * Throw if the connection i of connections does not belong to a
+   * connector of this process.
+   */
+  void assert_valid_connection_( const ConnectionArrays& connections,
+    size_t i ) const;
+
   /**
    * Update delay extrema to current values.
    *
@@ -371,6 +451,9 @@ private:
 
   tVVCounter vv_num_connections_;
 
+  //! Connections to be created by flush_staged_connections(), per thread.
+  std::vector< StagedConnections > staged_connections_;
+
   /**
    * BeginDocumentation
    * Name: connruledict - dictionary containing all connectivity rules
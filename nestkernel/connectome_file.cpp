@@ -0,0 +1,215 @@
+/*
+ *  connectome_file.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "connectome_file.h"
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstring>
+#include <fstream>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "sliexceptions.h"
+
+namespace
+{
+const char connectome_magic[ 8 ] = { 'N', 'E', 'S', 'T', 'C', 'O', 'N', 'N' };
+const uint32_t connectome_version = 1;
+
+//! Round n up to the next multiple of 8.
+inline uint64_t
+align_8( uint64_t n )
+{
+  return ( n + 7 ) & ~static_cast< uint64_t >( 7 );
+}
+}
+
+std::string
+nest::connectome_file_name( const std::string& prefix, int rank )
+{
+  return String::compose( "%1-%2.conn", prefix, rank );
+}
+
+void
+nest::write_connectome_file( const std::string& filename,
+  uint32_t num_processes,
+  uint32_t rank,
+  const std::vector< std::string >& models,
+  const std::vector< ConnectomeRecord >& records )
+{
+  std::ofstream out( filename.c_str(), std::ios::binary | std::ios::trunc );
+  if ( not out.good() )
+  {
+    LOG( M_ERROR,
+      "write_connectome_file",
+      String::compose( "Cannot open file '%1' for writing.", filename ) );
+    throw IOError();
+  }
+
+  uint64_t table_size = 0;
+  for ( size_t m = 0; m < models.size(); ++m )
+  {
+    table_size += sizeof( uint32_t ) + models[ m ].size();
+  }
+
+  ConnectomeFileHeader header;
+  std::memset( &header, 0, sizeof( header ) );
+  std::memcpy( header.magic_, connectome_magic, sizeof( header.magic_ ) );
+  header.version_ = connectome_version;
+  header.num_processes_ = num_processes;
+  header.rank_ = rank;
+  header.num_models_ = models.size();
+  header.num_records_ = records.size();
+  header.records_offset_ = align_8( sizeof( header ) + table_size );
+
+  out.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+  for ( size_t m = 0; m < models.size(); ++m )
+  {
+    const uint32_t length = models[ m ].size();
+    out.write( reinterpret_cast< const char* >( &length ), sizeof( length ) );
+    out.write( models[ m ].data(), length );
+  }
+  const char padding[ 8 ] = { 0 };
+  out.write(
+    padding, header.records_offset_ - sizeof( header ) - table_size );
+
+  if ( not records.empty() )
+  {
+    out.write( reinterpret_cast< const char* >( &records[ 0 ] ),
+      records.size() * sizeof( ConnectomeRecord ) );
+  }
+
+  out.close();
+  if ( out.fail() )
+  {
+    LOG( M_ERROR,
+      "write_connectome_file",
+      String::compose( "Error writing file '%1'.", filename ) );
+    throw IOError();
+  }
+}
+
+nest::MappedConnectomeFile::MappedConnectomeFile( const std::string& filename )
+  : data_( 0 )
+  , size_( 0 )
+  , models_()
+{
+  const int fd = open( filename.c_str(), O_RDONLY );
+  struct stat st;
+  if ( fd < 0 or fstat( fd, &st ) != 0 )
+  {
+    if ( fd >= 0 )
+    {
+      close( fd );
+    }
+    LOG( M_ERROR,
+      "MappedConnectomeFile",
+      String::compose( "Cannot open file '%1'.", filename ) );
+    throw IOError();
+  }
+
+  size_ = st.st_size;
+  if ( size_ >= sizeof( ConnectomeFileHeader ) )
+  {
+    data_ = mmap( 0, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+  }
+  close( fd );
+
+  if ( data_ == MAP_FAILED )
+  {
+    data_ = 0;
+    LOG( M_ERROR,
+      "MappedConnectomeFile",
+      String::compose( "Cannot map file '%1'.", filename ) );
+    throw IOError();
+  }
+
+  const std::string invalid =
+    String::compose( "'%1' is not a valid connectome file.", filename );
+  if ( data_ == 0 )
+  {
+    throw BadProperty( invalid );
+  }
+
+  const ConnectomeFileHeader& header = get_header();
+  if ( std::memcmp( header.magic_, connectome_magic, sizeof( header.magic_ ) )
+      != 0
+    or header.version_ != connectome_version
+    or header.records_offset_ % 8 != 0
+    or header.records_offset_ > size_
+    or header.num_records_
+      > ( size_ - header.records_offset_ ) / sizeof( ConnectomeRecord ) )
+  {
+    munmap( data_, size_ );
+    data_ = 0;
+    throw BadProperty( invalid );
+  }
+
+  // read the model name table
+  const char* p = static_cast< const char* >( data_ ) + sizeof( header );
+  const char* table_end =
+    static_cast< const char* >( data_ ) + header.records_offset_;
+  models_.reserve( header.num_models_ );
+  for ( uint32_t m = 0; m < header.num_models_; ++m )
+  {
+    uint32_t length = 0;
+    if ( table_end - p < static_cast< ptrdiff_t >( sizeof( length ) ) )
+    {
+      break;
+    }
+    std::memcpy( &length, p, sizeof( length ) );
+    p += sizeof( length );
+    if ( table_end - p < static_cast< ptrdiff_t >( length ) )
+    {
+      break;
+    }
+    models_.push_back( std::string( p, length ) );
+    p += length;
+  }
+  if ( models_.size() != header.num_models_ )
+  {
+    munmap( data_, size_ );
+    data_ = 0;
+    throw BadProperty( invalid );
+  }
+}
+
+nest::MappedConnectomeFile::~MappedConnectomeFile()
+{
+  if ( data_ != 0 )
+  {
+    munmap( data_, size_ );
+  }
+}
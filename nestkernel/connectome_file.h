@@ -0,0 +1,151 @@
+/*
+ *  connectome_file.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONNECTOME_FILE_H
+#define CONNECTOME_FILE_H
+
+// C includes:
+#include <stdint.h>
+
+// C++ includes:
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Binary connectome files.
+ *
+ * A connectome is stored in one file per MPI process, named
+ * <prefix>-<rank>.conn, containing the connections with targets on that
+ * process. Each file consists of
+ *
+ * - a ConnectomeFileHeader,
+ * - a table of synapse model names, each stored as a uint32_t length
+ *   followed by the characters of the name,
+ * - padding up to records_offset_, a multiple of 8,
+ * - num_records_ ConnectomeRecords.
+ *
+ * All numbers are stored in the byte order of the machine that wrote the
+ * file. Since records have fixed size, files can be memory-mapped and
+ * records read in place.
+ */
+struct ConnectomeFileHeader
+{
+  char magic_[ 8 ];         //!< "NESTCONN"
+  uint32_t version_;        //!< format version
+  uint32_t num_processes_;  //!< number of processes that wrote the files
+  uint32_t rank_;           //!< rank of the process that wrote this file
+  uint32_t num_models_;     //!< number of entries in the model name table
+  uint64_t num_records_;    //!< number of connection records
+  uint64_t records_offset_; //!< byte offset of the first record
+};
+
+/**
+ * A single connection in a connectome file.
+ */
+struct ConnectomeRecord
+{
+  uint64_t source_;   //!< GID of the source
+  uint64_t target_;   //!< GID of the target
+  double weight_;     //!< weight, NaN if the model has no individual weights
+  double delay_;      //!< delay in ms
+  uint32_t model_;    //!< index into the model name table
+  uint32_t reserved_; //!< padding, always 0
+};
+
+/**
+ * Return the name of the connectome file of the given rank.
+ */
+std::string connectome_file_name( const std::string& prefix, int rank );
+
+/**
+ * Write a connectome file.
+ * @throws IOError if the file cannot be written.
+ */
+void write_connectome_file( const std::string& filename,
+  uint32_t num_processes,
+  uint32_t rank,
+  const std::vector< std::string >& models,
+  const std::vector< ConnectomeRecord >& records );
+
+/**
+ * Read-only memory mapping of a connectome file.
+ */
+class MappedConnectomeFile
+{
+public:
+  /**
+   * Map the given file.
+   * @throws IOError if the file cannot be opened, KernelException if it
+   *         is not a valid connectome file.
+   */
+  explicit MappedConnectomeFile( const std::string& filename );
+  ~MappedConnectomeFile();
+
+  const ConnectomeFileHeader& get_header() const;
+
+  //! Synapse model names, indexed by ConnectomeRecord::model_.
+  const std::vector< std::string >& get_models() const;
+
+  const ConnectomeRecord* begin() const;
+  const ConnectomeRecord* end() const;
+
+private:
+  // prohibit copying
+  MappedConnectomeFile( const MappedConnectomeFile& );
+  MappedConnectomeFile& operator=( const MappedConnectomeFile& );
+
+  void* data_; //!< start of the mapping
+  size_t size_; //!< size of the mapping in bytes
+  std::vector< std::string > models_;
+};
+
+inline const ConnectomeFileHeader&
+MappedConnectomeFile::get_header() const
+{
+  return *static_cast< const ConnectomeFileHeader* >( data_ );
+}
+
+inline const std::vector< std::string >&
+MappedConnectomeFile::get_models() const
+{
+  return models_;
+}
+
+inline const ConnectomeRecord*
+MappedConnectomeFile::begin() const
+{
+  return reinterpret_cast< const ConnectomeRecord* >(
+    static_cast< const char* >( data_ ) + get_header().records_offset_ );
+}
+
+inline const ConnectomeRecord*
+MappedConnectomeFile::end() const
+{
+  return begin() + get_header().num_records_;
+}
+
+} // namespace nest
+
+#endif /* CONNECTOME_FILE_H */
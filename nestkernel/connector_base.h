@@ -27,6 +27,7 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>
 #include <vector>
 #include <deque>
@@ -35,10 +36,12 @@
 #include "compose.hpp"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "common_synapse_properties.h"
 #include "connection_label.h"
 #include "connector_model.h"
 #include "event.h"
+#include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_datums.h"
 #include "nest_names.h"
@@ -162,6 +165,44 @@ public:
     long synapse_label,
     std::deque< ConnectionID >& conns ) const = 0;
 
+  /**
+   * Append all connections of type synapse_id with the given label to
+   * conns. If targets is not 0, only connections to the targets in the
+   * sorted vector targets are appended.
+   */
+  virtual void get_connection_arrays( index source_gid,
+    thread tid,
+    synindex synapse_id,
+    long synapse_label,
+    const std::vector< index >* targets,
+    ConnectionArrays& conns ) = 0;
+
+  /**
+   * Read a single property of the connection of type syn_id at port p.
+   * Properties without direct access are read from the status dictionary
+   * only if use_status is true. This allocates Datums, which must not be
+   * done by several threads at once.
+   * @returns false if the property was left for the status dictionary.
+   * @throws InexistentConnection if there is no connection at port p.
+   * @throws BadProperty if the connection has no such numeric property.
+   */
+  virtual bool get_synapse_property( synindex syn_id,
+    port p,
+    const Name& name,
+    double& value,
+    bool use_status ) = 0;
+
+  /**
+   * Set a single property of the connection of type syn_id at port p,
+   * see get_synapse_property().
+   */
+  virtual bool set_synapse_property( synindex syn_id,
+    ConnectorModel& cm,
+    port p,
+    const Name& name,
+    double value,
+    bool use_status ) = 0;
+
   virtual void get_target_gids( std::vector< size_t >& target_gids,
     size_t thrd,
     synindex synapse_id,
@@ -190,6 +231,13 @@ public:
   // returns true, if all synapse models are of same type
   virtual bool homogeneous_model() = 0;
 
+  /**
+   * Store all connections in a checkpoint. Each homogeneous connector
+   * writes its syn_id, followed by the data read by
+   * ConnectorModel::restore_connections().
+   */
+  virtual void save_connections( CheckpointWriter& writer, thread tid ) = 0;
+
   // destructor needed to delete connections
   virtual ~ConnectorBase(){};
 
@@ -246,6 +294,137 @@ public:
   virtual size_t size() = 0;
   virtual ConnectionT& at( size_t i ) = 0;
 
+  /**
+   * Request room for n connections. Only connectors with at least
+   * K_CUTOFF connections can grow in place, all others ignore the request.
+   */
+  virtual void
+  reserve( size_t )
+  {
+  }
+
+  void
+  get_connection_arrays( index source_gid,
+    thread tid,
+    synindex synapse_id,
+    long synapse_label,
+    const std::vector< index >* targets,
+    ConnectionArrays& conns )
+  {
+    if ( get_syn_id() != synapse_id )
+    {
+      return;
+    }
+    const size_t n = size();
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const ConnectionT& c = at( i );
+      if ( synapse_label != UNLABELED_CONNECTION
+        and c.get_label() != synapse_label )
+      {
+        continue;
+      }
+      const index target_gid = c.get_target( tid )->get_gid();
+      if ( targets == 0
+        or std::binary_search( targets->begin(), targets->end(), target_gid ) )
+      {
+        conns.push_back( source_gid, target_gid, tid, synapse_id, i );
+      }
+    }
+  }
+
+  /**
+   * Properties that the connection type does not give direct access to
+   * are read from its status dictionary.
+   */
+  bool
+  get_synapse_property( synindex syn_id,
+    port p,
+    const Name& name,
+    double& value,
+    bool use_status )
+  {
+    if ( syn_id != get_syn_id() or p < 0
+      or static_cast< size_t >( p ) >= size() )
+    {
+      throw InexistentConnection();
+    }
+    const ConnectionT& c = at( p );
+    if ( not c.get_property( name, value ) )
+    {
+      if ( not use_status )
+      {
+        return false;
+      }
+      DictionaryDatum d( new Dictionary );
+      c.get_status( d );
+      const Token& t = d->lookup( name );
+      if ( t.empty() )
+      {
+        throw BadProperty( String::compose(
+          "The connections have no property '%1'.", name ) );
+      }
+      value = getValue< double >( t );
+    }
+    return true;
+  }
+
+  bool
+  set_synapse_property( synindex syn_id,
+    ConnectorModel& cm,
+    port p,
+    const Name& name,
+    double value,
+    bool use_status )
+  {
+    if ( syn_id != get_syn_id() or p < 0
+      or static_cast< size_t >( p ) >= size() )
+    {
+      throw InexistentConnection();
+    }
+    ConnectionT& c = at( p );
+    GenericConnectorModel< ConnectionT >& gcm =
+      static_cast< GenericConnectorModel< ConnectionT >& >( cm );
+    if ( not c.set_property( name, value, gcm ) )
+    {
+      if ( not use_status )
+      {
+        return false;
+      }
+      DictionaryDatum d( new Dictionary );
+      def< double >( d, name, value );
+      d->clear_access_flags();
+      c.set_status( d, gcm );
+      std::string missed;
+      if ( not d->all_accessed( missed ) )
+      {
+        throw BadProperty( String::compose(
+          "The connections have no property '%1'.", name ) );
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Connections are stored by ConnectionT::save_state() together with the
+   * gid of their target, which is reset when the connection is restored.
+   * Connection types without checkpoint support throw NotImplemented.
+   */
+  void
+  save_connections( CheckpointWriter& writer, thread tid )
+  {
+    writer.write( get_syn_id() );
+    writer.write( get_t_lastspike() );
+    const size_t n = size();
+    writer.write( n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const ConnectionT& c = at( i );
+      writer.write< index >( c.get_target( tid )->get_gid() );
+      c.save_state( writer );
+    }
+  }
+
   void
   send_secondary( SecondaryEvent&,
     thread,
@@ -816,6 +995,25 @@ public:
     C_[ K_CUTOFF - 1 ] = c;
   };
 
+  /**
+   * Creates a new connector holding the connections of a smaller
+   * connector, with room for capacity connections in total. This lets a
+   * connector that receives many connections at once skip the
+   * intermediate sizes.
+   *
+   * @param C Original connector of size less than K_CUTOFF
+   * @param capacity The number of connections to reserve room for.
+   */
+  Connector( vector_like< ConnectionT >& C, size_t capacity )
+  {
+    C_.reserve( std::max( capacity, C.size() ) );
+    for ( size_t k = 0; k < C.size(); k++ )
+    {
+      C_.push_back( C.at( k ) );
+    }
+    this->set_t_lastspike( C.get_t_lastspike() );
+  }
+
   /**
    * Creates a new connector and removes the ith connection. To do so, the
    * contents of the original connector are copied into the new one. The copy is
@@ -918,6 +1116,12 @@ public:
     return *this;
   }
 
+  void
+  reserve( size_t n )
+  {
+    C_.reserve( n );
+  }
+
   ConnectorBase&
   erase( size_t i )
   {
@@ -1256,6 +1460,70 @@ public:
     return false;
   }
 
+  void
+  get_connection_arrays( index source_gid,
+    thread tid,
+    synindex synapse_id,
+    long synapse_label,
+    const std::vector< index >* targets,
+    ConnectionArrays& conns )
+  {
+    for ( size_t i = 0; i < size(); i++ )
+    {
+      if ( synapse_id == at( i )->get_syn_id() )
+      {
+        at( i )->get_connection_arrays(
+          source_gid, tid, synapse_id, synapse_label, targets, conns );
+      }
+    }
+  }
+
+  bool
+  get_synapse_property( synindex syn_id,
+    port p,
+    const Name& name,
+    double& value,
+    bool use_status )
+  {
+    for ( size_t i = 0; i < size(); i++ )
+    {
+      if ( syn_id == at( i )->get_syn_id() )
+      {
+        return at( i )->get_synapse_property(
+          syn_id, p, name, value, use_status );
+      }
+    }
+    throw InexistentConnection();
+  }
+
+  bool
+  set_synapse_property( synindex syn_id,
+    ConnectorModel& cm,
+    port p,
+    const Name& name,
+    double value,
+    bool use_status )
+  {
+    for ( size_t i = 0; i < size(); i++ )
+    {
+      if ( syn_id == at( i )->get_syn_id() )
+      {
+        return at( i )->set_synapse_property(
+          syn_id, cm, p, name, value, use_status );
+      }
+    }
+    throw InexistentConnection();
+  }
+
+  void
+  save_connections( CheckpointWriter& writer, thread tid )
+  {
+    for ( size_t i = 0; i < size(); i++ )
+    {
+      at( i )->save_connections( writer, tid );
+    }
+  }
+
   void
   add_connector( bool is_primary, ConnectorBase* conn )
   {
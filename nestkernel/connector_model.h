@@ -34,13 +34,17 @@
 #include "event.h"
 #include "nest_time.h"
 #include "nest_types.h"
+#include "staged_connection.h"
 
 // Includes from sli:
 #include "dictutils.h"
 
 namespace nest
 {
+class CheckpointReader;
 class ConnectorBase;
+template < typename ConnectionT >
+class vector_like;
 class CommonSynapseProperties;
 class TimeConverter;
 class Node;
@@ -127,6 +131,35 @@ public:
     double delay = numerics::nan,
     double weight = numerics::nan ) = 0;
 
+  /**
+   * Add connections from src to the targets of all staged connections in
+   * [first, last). The result is the same as calling add_connection() for
+   * each entry in turn, but the connector for syn_id is allocated with
+   * room for all new connections at once instead of growing one by one.
+   * @param conn Connector of src, updated as connections are added
+   * @param first On return, points past the last connection added; if an
+   *              exception is thrown, points to the connection that failed
+   * @param exact_capacity If false, reserve additional room for
+   *                       connections added by later calls
+   */
+  virtual void add_connections( Node& src,
+    ConnectorBase*& conn,
+    synindex syn_id,
+    StagedConnections::const_iterator& first,
+    StagedConnections::const_iterator last,
+    bool exact_capacity ) = 0;
+
+  /**
+   * Restore the connections of src stored by a homogeneous connector of
+   * type syn_id in ConnectorBase::save_connections().
+   * @param conn Connector of src, updated as connections are added
+   */
+  virtual void restore_connections( Node& src,
+    ConnectorBase*& conn,
+    synindex syn_id,
+    thread tid,
+    CheckpointReader& reader ) = 0;
+
   /**
    * Delete a connection of a given type directed to a defined target Node
    * @param tgt Target node
@@ -243,6 +276,19 @@ public:
     double weight,
     double delay );
 
+  void add_connections( Node& src,
+    ConnectorBase*& conn,
+    synindex syn_id,
+    StagedConnections::const_iterator& first,
+    StagedConnections::const_iterator last,
+    bool exact_capacity );
+
+  void restore_connections( Node& src,
+    ConnectorBase*& conn,
+    synindex syn_id,
+    thread tid,
+    CheckpointReader& reader );
+
   ConnectorBase* delete_connection( Node& tgt,
     size_t target_thread,
     ConnectorBase* conn,
@@ -294,6 +340,28 @@ public:
 private:
   void used_default_delay();
 
+  /**
+   * Create a copy of the default connection with the given delay and
+   * weight, checking the delay. Arguments that are numerics::nan are
+   * ignored.
+   */
+  ConnectionT new_connection_( double delay, double weight );
+
+  /**
+   * Return the homogeneous connector for syn_id contained in conn.
+   */
+  vector_like< ConnectionT >* get_connector_( ConnectorBase* conn,
+    synindex syn_id ) const;
+
+  /**
+   * Replace the fixed-size connector vc contained in conn by a connector
+   * storing the same connections in a std::vector with room for capacity
+   * connections. vc is no longer valid afterwards.
+   */
+  void grow_connector_( ConnectorBase*& conn,
+    vector_like< ConnectionT >* vc,
+    size_t capacity ) const;
+
   ConnectorBase* add_connection( Node& src,
     Node& tgt,
     ConnectorBase* conn,
@@ -25,6 +25,9 @@
 
 #include "connector_model.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Generated includes:
 #include "config.h"
 
@@ -240,6 +243,15 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
   synindex syn_id,
   double delay,
   double weight )
+{
+  ConnectionT c = new_connection_( delay, weight );
+  return add_connection( src, tgt, conn, syn_id, c, receptor_type_ );
+}
+
+template < typename ConnectionT >
+ConnectionT
+GenericConnectorModel< ConnectionT >::new_connection_( double delay,
+  double weight )
 {
   if ( not numerics::is_nan( delay ) && has_delay_ )
   {
@@ -263,7 +275,167 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
     used_default_delay();
   }
 
-  return add_connection( src, tgt, conn, syn_id, c, receptor_type_ );
+  return c;
+}
+
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::add_connections( Node& src,
+  ConnectorBase*& conn,
+  synindex syn_id,
+  StagedConnections::const_iterator& first,
+  StagedConnections::const_iterator last,
+  bool exact_capacity )
+{
+  // The first connection is added with add_connection(), which creates the
+  // connector for syn_id if needed. If the connector then reaches K_CUTOFF
+  // connections with the remaining ones, it is replaced by a connector
+  // storing its connections in a std::vector with room for all of them,
+  // skipping the intermediate fixed-size connectors. An existing vector
+  // connector is reserved instead, so that it is reallocated at most once.
+  bool reserved = false;
+  for ( ; first != last; ++first )
+  {
+    ConnectionT c = new_connection_( first->delay_, first->weight_ );
+    conn =
+      add_connection( src, *first->target_, conn, syn_id, c, receptor_type_ );
+
+    if ( not reserved )
+    {
+      vector_like< ConnectionT >* vc = get_connector_( conn, syn_id );
+      const size_t remaining = ( last - first ) - 1;
+      if ( vc->size() + remaining >= K_CUTOFF )
+      {
+        size_t capacity = vc->size() + remaining;
+        if ( not exact_capacity )
+        {
+          capacity = std::max( capacity, 2 * vc->size() );
+        }
+        if ( vc->size() < K_CUTOFF )
+        {
+          grow_connector_( conn, vc, capacity );
+        }
+        else
+        {
+          vc->reserve( capacity );
+        }
+        reserved = true;
+      }
+    }
+  }
+}
+
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::restore_connections( Node& src,
+  ConnectorBase*& conn,
+  synindex syn_id,
+  thread tid,
+  CheckpointReader& reader )
+{
+  double t_lastspike = 0.0;
+  size_t n = 0;
+  reader.read( t_lastspike );
+  reader.read( n );
+
+  bool reserved = false;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    index tgid = 0;
+    ConnectionT c( default_connection_ );
+    c.set_syn_id( syn_id );
+    reader.read( tgid );
+    c.restore_state( reader );
+
+    if ( has_delay_ )
+    {
+      kernel().connection_manager.get_delay_checker().assert_valid_delay_ms(
+        c.get_delay() );
+    }
+    Node* tgt = kernel().node_manager.get_node( tgid, tid );
+    conn = add_connection( src, *tgt, conn, syn_id, c, c.get_rport() );
+
+    if ( not reserved )
+    {
+      vector_like< ConnectionT >* vc = get_connector_( conn, syn_id );
+      const size_t capacity = vc->size() + n - i - 1;
+      if ( capacity >= K_CUTOFF )
+      {
+        if ( vc->size() < K_CUTOFF )
+        {
+          grow_connector_( conn, vc, capacity );
+        }
+        else
+        {
+          vc->reserve( capacity );
+        }
+        reserved = true;
+      }
+    }
+  }
+
+  if ( n > 0 )
+  {
+    get_connector_( conn, syn_id )->set_t_lastspike( t_lastspike );
+  }
+}
+
+template < typename ConnectionT >
+vector_like< ConnectionT >*
+GenericConnectorModel< ConnectionT >::get_connector_( ConnectorBase* conn,
+  synindex syn_id ) const
+{
+  conn = validate_pointer( conn );
+  if ( conn->homogeneous_model() )
+  {
+    assert( conn->get_syn_id() == syn_id );
+    return static_cast< vector_like< ConnectionT >* >( conn );
+  }
+
+  HetConnector* hc = static_cast< HetConnector* >( conn );
+  for ( size_t i = 0; i < hc->size(); ++i )
+  {
+    if ( ( *hc )[ i ]->get_syn_id() == syn_id )
+    {
+      return static_cast< vector_like< ConnectionT >* >( ( *hc )[ i ] );
+    }
+  }
+  assert( false );
+  return 0;
+}
+
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::grow_connector_( ConnectorBase*& conn,
+  vector_like< ConnectionT >* vc,
+  size_t capacity ) const
+{
+  const bool b_has_primary = has_primary( conn );
+  const bool b_has_secondary = has_secondary( conn );
+  ConnectorBase* c = validate_pointer( conn );
+  if ( c->homogeneous_model() )
+  {
+    assert( c == vc );
+    conn = pack_pointer(
+      suicide_and_resurrect< Connector< K_CUTOFF, ConnectionT > >(
+        vc, capacity ),
+      b_has_primary,
+      b_has_secondary );
+    return;
+  }
+
+  HetConnector* hc = static_cast< HetConnector* >( c );
+  for ( size_t i = 0; i < hc->size(); ++i )
+  {
+    if ( ( *hc )[ i ] == vc )
+    {
+      ( *hc )[ i ] =
+        suicide_and_resurrect< Connector< K_CUTOFF, ConnectionT > >(
+          vc, capacity );
+      return;
+    }
+  }
+  assert( false );
 }
 
 /**
@@ -666,29 +666,48 @@ DataLoggingRequest::record_from() const
 class DataLoggingReply : public Event
 {
 public:
-  //! Data type data at single recording time
-  typedef std::vector< double > DataItem;
-
-  /** Data item with pertaining time stamp.
-   * Items are initialized with time stamp -inf to mark them as invalid.
+  /** Data recorded during one time slice, with pertaining time stamps.
+   * Data is stored contiguously, one row of num_vars values per recording
+   * time, so that no memory needs to be allocated per recorded data point.
+   * Rows are initialized with time stamp -inf to mark them as invalid.
    * Data is initialized to <double>::max() as a highly implausible value.
    * Ideally, we should initialized to a NaN, but since the C++-standard does
    * not require NaN, that would result in unportable code. max() should draw
    * the users att
    */
-  struct Item
+  struct Container
   {
-    Item( size_t n )
-      : data( n, std::numeric_limits< double >::max() )
-      , timestamp( Time::neg_inf() )
+    Container( size_t n_rows, size_t n_vars )
+      : num_vars( n_vars )
+      , timestamps( n_rows, Time::neg_inf() )
+      , data( n_rows * n_vars, std::numeric_limits< double >::max() )
     {
     }
-    DataItem data;
-    Time timestamp;
-  };
 
-  //! Container for entries
-  typedef std::vector< Item > Container;
+    //! Number of rows, i.e., recording times
+    size_t
+    size() const
+    {
+      return timestamps.size();
+    }
+
+    //! Pointer to first of num_vars values of row j, 0 if num_vars is 0
+    double*
+    row( size_t j )
+    {
+      return num_vars == 0 ? 0 : &data[ j * num_vars ];
+    }
+
+    const double*
+    row( size_t j ) const
+    {
+      return num_vars == 0 ? 0 : &data[ j * num_vars ];
+    }
+
+    size_t num_vars;               //!< number of values per row
+    std::vector< Time > timestamps; //!< time stamp for each row
+    std::vector< double > data;     //!< values, row by row
+  };
 
   //! Construct with reference to data and time stamps to transmit
   DataLoggingReply( const Container& );
@@ -29,6 +29,7 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "vp_manager.h"
@@ -107,6 +108,52 @@ EventDeliveryManager::clear_pending_spikes()
   configure_spike_buffers();
 }
 
+void
+EventDeliveryManager::save_pending_spikes( CheckpointWriter& writer ) const
+{
+  writer.write( kernel().mpi_manager.get_send_buffer_size() );
+  writer.write( kernel().mpi_manager.get_recv_buffer_size() );
+  for ( size_t t = 0; t < spike_register_.size(); ++t )
+  {
+    for ( size_t lag = 0; lag < spike_register_[ t ].size(); ++lag )
+    {
+      writer.write_vector( spike_register_[ t ][ lag ] );
+      writer.write_vector( offgrid_spike_register_[ t ][ lag ] );
+    }
+    writer.write_vector( secondary_events_buffer_[ t ] );
+  }
+  writer.write_vector( global_grid_spikes_ );
+  writer.write_vector( global_offgrid_spikes_ );
+  writer.write_vector( displacements_ );
+}
+
+void
+EventDeliveryManager::restore_pending_spikes( CheckpointReader& reader )
+{
+  configure_spike_buffers();
+
+  int send_buffer_size = 0;
+  int recv_buffer_size = 0;
+  reader.read( send_buffer_size );
+  reader.read( recv_buffer_size );
+  kernel().mpi_manager.set_buffer_sizes( send_buffer_size, recv_buffer_size );
+  local_grid_spikes_.resize( send_buffer_size, 0U );
+  local_offgrid_spikes_.resize( send_buffer_size, OffGridSpike( 0, 0.0 ) );
+
+  for ( size_t t = 0; t < spike_register_.size(); ++t )
+  {
+    for ( size_t lag = 0; lag < spike_register_[ t ].size(); ++lag )
+    {
+      reader.read_vector( spike_register_[ t ][ lag ] );
+      reader.read_vector( offgrid_spike_register_[ t ][ lag ] );
+    }
+    reader.read_vector( secondary_events_buffer_[ t ] );
+  }
+  reader.read_vector( global_grid_spikes_ );
+  reader.read_vector( global_offgrid_spikes_ );
+  reader.read_vector( displacements_ );
+}
+
 void
 EventDeliveryManager::configure_spike_buffers()
 {
@@ -43,6 +43,9 @@
 
 namespace nest
 {
+class CheckpointWriter;
+class CheckpointReader;
+
 typedef MPIManager::OffGridSpike OffGridSpike;
 
 class EventDeliveryManager : public ManagerInterface
@@ -163,6 +166,19 @@ public:
    */
   void clear_pending_spikes();
 
+  /**
+   * Store all spikes and secondary events not yet delivered in a
+   * checkpoint.
+   */
+  void save_pending_spikes( CheckpointWriter& ) const;
+
+  /**
+   * Restore the pending spikes stored by save_pending_spikes(). This
+   * configures the spike buffers, so that they are not reconfigured
+   * by the next call to simulate().
+   */
+  void restore_pending_spikes( CheckpointReader& );
+
   /**
    * Return (T+d) mod max_delay.
    */
@@ -25,24 +25,65 @@
 // C includes:
 #include <dirent.h>
 #include <errno.h>
+#include <stdint.h>
 #include <sys/types.h>
 
 // C++ includes:
 #include <cstdlib>
+#include <sstream>
 
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "kernel_manager.h"
 
 // Includes from sli:
 #include "dictutils.h"
+#include "sliexceptions.h"
+
+nest::IOManager::WriteRequest_::WriteRequest_( std::ofstream* fs,
+  index gid,
+  thread vp,
+  const std::string& label,
+  const std::string& data,
+  bool flush )
+  : fs_( fs )
+  , gid_( gid )
+  , vp_( vp )
+  , label_( label )
+  , data_( data )
+  , flush_( flush )
+{
+}
 
 nest::IOManager::IOManager()
   : overwrite_files_( false )
+  , aggregate_recordings_( false )
+  , recording_chunk_size_( 65536 )
+  , async_recordings_( false )
+  , recording_buffer_limit_( 16777216 )
+  , writer_running_( false )
+  , writer_stop_( false )
+  , writer_busy_( false )
+  , writer_error_( false )
+  , queued_bytes_( 0 )
+  , pending_requests_()
 {
+  pthread_mutex_init( &writer_mutex_, NULL );
+  pthread_cond_init( &writer_wakeup_, NULL );
+  pthread_cond_init( &writer_progress_, NULL );
+}
+
+nest::IOManager::~IOManager()
+{
+  stop_writer_();
+
+  pthread_cond_destroy( &writer_progress_ );
+  pthread_cond_destroy( &writer_wakeup_ );
+  pthread_mutex_destroy( &writer_mutex_ );
 }
 
 void
@@ -117,19 +158,64 @@ nest::IOManager::initialize()
 void
 nest::IOManager::finalize()
 {
+  stop_writer_();
+  writer_error_ = false;
+  close_aggregate_streams_();
+
   data_path_ = "";
   data_prefix_ = "";
   overwrite_files_ = false;
+  aggregate_recordings_ = false;
+  recording_chunk_size_ = 65536;
+  async_recordings_ = false;
+  recording_buffer_limit_ = 16777216;
 }
 
 /*
      - set the data_path, data_prefix and overwrite_files properties
+     - set the aggregate_recordings and recording_chunk_size properties
+     - set the async_recordings and recording_buffer_limit properties
 */
 void
 nest::IOManager::set_status( const DictionaryDatum& d )
 {
+  long chunk_size = 0;
+  if ( updateValue< long >( d, names::recording_chunk_size, chunk_size ) )
+  {
+    if ( chunk_size <= 0 )
+    {
+      throw BadProperty( "recording_chunk_size must be > 0." );
+    }
+    recording_chunk_size_ = chunk_size;
+  }
+
+  long buffer_limit = 0;
+  if ( updateValue< long >( d, names::recording_buffer_limit, buffer_limit ) )
+  {
+    if ( buffer_limit <= 0 )
+    {
+      throw BadProperty( "recording_buffer_limit must be > 0." );
+    }
+    recording_buffer_limit_ = buffer_limit;
+  }
+
+  // the I/O thread is started by prepare()
+  updateValue< bool >( d, names::async_recordings, async_recordings_ );
+  if ( not async_recordings_ )
+  {
+    stop_writer_();
+  }
+
   set_data_path_prefix_( d );
   updateValue< bool >( d, names::overwrite_files, overwrite_files_ );
+  updateValue< bool >( d, names::aggregate_recordings, aggregate_recordings_ );
+
+  // open_aggregate_streams() re-opens the files on the next call to
+  // Simulate if their name has changed
+  if ( not aggregate_recordings_ )
+  {
+    close_aggregate_streams_();
+  }
 }
 
 void
@@ -138,4 +224,355 @@ nest::IOManager::get_status( DictionaryDatum& d )
   ( *d )[ names::data_path ] = data_path_;
   ( *d )[ names::data_prefix ] = data_prefix_;
   ( *d )[ names::overwrite_files ] = overwrite_files_;
+  ( *d )[ names::aggregate_recordings ] = aggregate_recordings_;
+  ( *d )[ names::recording_chunk_size ] =
+    static_cast< long >( recording_chunk_size_ );
+  ( *d )[ names::async_recordings ] = async_recordings_;
+  ( *d )[ names::recording_buffer_limit ] =
+    static_cast< long >( recording_buffer_limit_ );
+}
+
+std::string
+nest::IOManager::get_aggregate_filename() const
+{
+  std::ostringstream basename;
+  if ( not data_path_.empty() )
+  {
+    basename << data_path_ << '/';
+  }
+  basename << data_prefix_ << "recordings-"
+           << kernel().mpi_manager.get_rank();
+  return basename.str();
+}
+
+void
+nest::IOManager::open_aggregate_streams()
+{
+  bool success = true;
+
+#pragma omp critical( aggregate_recordings )
+  {
+    const std::string filename = get_aggregate_filename();
+    if ( aggregate_fs_.is_open() and filename != aggregate_filename_ )
+    {
+      std::string msg = String::compose(
+        "Closing file '%1.dat', opening file '%2.dat'",
+        aggregate_filename_,
+        filename );
+      LOG( M_INFO, "IOManager::open_aggregate_streams()", msg );
+      close_aggregate_streams_();
+    }
+
+    if ( not aggregate_fs_.is_open() )
+    {
+      const std::string data_name = filename + ".dat";
+      const std::string index_name = filename + ".idx";
+
+      bool exists = false;
+      if ( not overwrite_files_ )
+      {
+        std::ifstream test( data_name.c_str() );
+        exists = test.good();
+      }
+
+      if ( not exists )
+      {
+        aggregate_fs_.open(
+          data_name.c_str(), std::ios::out | std::ios::binary );
+        aggregate_index_fs_.open( index_name.c_str() );
+        aggregate_index_fs_ << "# gid\tvp\toffset\tsize\tlabel\n";
+      }
+
+      if ( exists or not aggregate_fs_.good()
+        or not aggregate_index_fs_.good() )
+      {
+        close_aggregate_streams_();
+        success = false;
+      }
+      else
+      {
+        aggregate_filename_ = filename;
+      }
+    }
+  }
+
+  // errors are reported outside the critical section
+  if ( not success )
+  {
+    std::string msg = String::compose(
+      "Could not open aggregate recording file '%1.dat'. The file may exist "
+      "already and will not be overwritten. Please change data_path or "
+      "data_prefix, or set /overwrite_files to true in the root node.",
+      get_aggregate_filename() );
+    LOG( M_ERROR, "IOManager::open_aggregate_streams()", msg );
+    throw IOError();
+  }
+}
+
+void
+nest::IOManager::write_aggregate_chunk( index gid,
+  thread vp,
+  const std::string& label,
+  const std::string& data )
+{
+  if ( data.empty() )
+  {
+    return;
+  }
+
+  if ( writer_running_ )
+  {
+    WriteRequest_ request( 0, gid, vp, label, data, false );
+    enqueue_request_( request );
+    return;
+  }
+
+#pragma omp critical( aggregate_recordings )
+  {
+    append_aggregate_chunk_( gid, vp, label, data );
+  }
+}
+
+void
+nest::IOManager::write_chunk( std::ofstream& fs,
+  const std::string& data,
+  bool flush )
+{
+  if ( data.empty() and not flush )
+  {
+    return;
+  }
+
+  if ( writer_running_ )
+  {
+    WriteRequest_ request( &fs, 0, 0, "", data, flush );
+    enqueue_request_( request );
+    return;
+  }
+
+  fs.write( data.data(), data.size() );
+  if ( flush )
+  {
+    fs.flush();
+  }
+}
+
+void
+nest::IOManager::append_aggregate_chunk_( index gid,
+  thread vp,
+  const std::string& label,
+  const std::string& data )
+{
+  assert( aggregate_fs_.is_open() );
+
+  const uint64_t header_gid = gid;
+  const uint32_t header_vp = vp;
+  const uint32_t header_reserved = 0;
+  const uint64_t header_size = data.size();
+
+  aggregate_fs_.write(
+    reinterpret_cast< const char* >( &header_gid ), sizeof( header_gid ) );
+  aggregate_fs_.write(
+    reinterpret_cast< const char* >( &header_vp ), sizeof( header_vp ) );
+  aggregate_fs_.write( reinterpret_cast< const char* >( &header_reserved ),
+    sizeof( header_reserved ) );
+  aggregate_fs_.write(
+    reinterpret_cast< const char* >( &header_size ), sizeof( header_size ) );
+
+  const std::streamoff offset = aggregate_fs_.tellp();
+  aggregate_fs_.write( data.data(), data.size() );
+
+  aggregate_index_fs_ << gid << '\t' << vp << '\t' << offset << '\t'
+                      << data.size() << '\t' << label << '\n';
+}
+
+void
+nest::IOManager::prepare()
+{
+  if ( async_recordings_ )
+  {
+    start_writer_();
+  }
+}
+
+void
+nest::IOManager::post_run_cleanup()
+{
+  synchronize();
+
+  if ( writer_error_ )
+  {
+    writer_error_ = false;
+    LOG( M_ERROR,
+      "IOManager::post_run_cleanup()",
+      "I/O error while writing recorded data to file." );
+
+    throw IOError();
+  }
+
+  if ( aggregate_fs_.is_open() )
+  {
+    aggregate_fs_.flush();
+    aggregate_index_fs_.flush();
+
+    if ( not aggregate_fs_.good() or not aggregate_index_fs_.good() )
+    {
+      std::string msg = String::compose(
+        "I/O error while writing file '%1.dat'", aggregate_filename_ );
+      LOG( M_ERROR, "IOManager::post_run_cleanup()", msg );
+
+      throw IOError();
+    }
+  }
+}
+
+void
+nest::IOManager::enqueue_request_( WriteRequest_& request )
+{
+  pthread_mutex_lock( &writer_mutex_ );
+
+  // back-pressure: wait for the I/O thread to take over the queued data
+  while ( queued_bytes_ >= recording_buffer_limit_ )
+  {
+    pthread_cond_wait( &writer_progress_, &writer_mutex_ );
+  }
+
+  queued_bytes_ += request.data_.size();
+
+  // swap data into the queue to avoid copying the chunk once more
+  pending_requests_.push_back( WriteRequest_( request.fs_,
+    request.gid_,
+    request.vp_,
+    request.label_,
+    std::string(),
+    request.flush_ ) );
+  pending_requests_.back().data_.swap( request.data_ );
+
+  pthread_cond_signal( &writer_wakeup_ );
+  pthread_mutex_unlock( &writer_mutex_ );
+}
+
+void
+nest::IOManager::synchronize()
+{
+  if ( not writer_running_ )
+  {
+    return;
+  }
+
+  pthread_mutex_lock( &writer_mutex_ );
+  while ( not pending_requests_.empty() or writer_busy_ )
+  {
+    pthread_cond_wait( &writer_progress_, &writer_mutex_ );
+  }
+  pthread_mutex_unlock( &writer_mutex_ );
+}
+
+void
+nest::IOManager::start_writer_()
+{
+  if ( writer_running_ )
+  {
+    return;
+  }
+
+  writer_stop_ = false;
+  if ( pthread_create( &writer_thread_, NULL, writer_main_, this ) != 0 )
+  {
+    throw KernelException( "IOManager: Could not start I/O thread." );
+  }
+  writer_running_ = true;
+}
+
+void
+nest::IOManager::stop_writer_()
+{
+  if ( not writer_running_ )
+  {
+    return;
+  }
+
+  pthread_mutex_lock( &writer_mutex_ );
+  writer_stop_ = true;
+  pthread_cond_signal( &writer_wakeup_ );
+  pthread_mutex_unlock( &writer_mutex_ );
+
+  // the I/O thread writes all pending data before it terminates
+  pthread_join( writer_thread_, NULL );
+  writer_running_ = false;
+}
+
+void*
+nest::IOManager::writer_main_( void* arg )
+{
+  static_cast< IOManager* >( arg )->run_writer_();
+  return NULL;
+}
+
+void
+nest::IOManager::run_writer_()
+{
+  // buffer written by this thread while simulation threads fill the other
+  std::vector< WriteRequest_ > requests;
+
+  pthread_mutex_lock( &writer_mutex_ );
+  while ( true )
+  {
+    while ( pending_requests_.empty() and not writer_stop_ )
+    {
+      pthread_cond_wait( &writer_wakeup_, &writer_mutex_ );
+    }
+    if ( pending_requests_.empty() )
+    {
+      break; // stop requested and all data written
+    }
+
+    requests.swap( pending_requests_ );
+    queued_bytes_ = 0;
+    writer_busy_ = true;
+    pthread_cond_broadcast( &writer_progress_ );
+    pthread_mutex_unlock( &writer_mutex_ );
+
+    bool error = false;
+    for ( std::vector< WriteRequest_ >::iterator r = requests.begin();
+          r != requests.end();
+          ++r )
+    {
+      if ( r->fs_ == 0 )
+      {
+        append_aggregate_chunk_( r->gid_, r->vp_, r->label_, r->data_ );
+        error = error or not aggregate_fs_.good();
+      }
+      else
+      {
+        r->fs_->write( r->data_.data(), r->data_.size() );
+        if ( r->flush_ )
+        {
+          r->fs_->flush();
+        }
+        error = error or not r->fs_->good();
+      }
+    }
+    requests.clear();
+
+    pthread_mutex_lock( &writer_mutex_ );
+    writer_busy_ = false;
+    writer_error_ = writer_error_ or error;
+    pthread_cond_broadcast( &writer_progress_ );
+  }
+  pthread_mutex_unlock( &writer_mutex_ );
+}
+
+void
+nest::IOManager::close_aggregate_streams_()
+{
+  if ( aggregate_fs_.is_open() )
+  {
+    aggregate_fs_.close();
+  }
+  if ( aggregate_index_fs_.is_open() )
+  {
+    aggregate_index_fs_.close();
+  }
+  aggregate_filename_.clear();
 }
@@ -23,12 +23,20 @@
 #ifndef IO_MANAGER_H
 #define IO_MANAGER_H
 
+// C includes:
+#include <pthread.h>
+
 // C++ includes:
+#include <fstream>
 #include <string>
+#include <vector>
 
 // Includes from libnestutil:
 #include "manager_interface.h"
 
+// Includes from nestkernel:
+#include "nest_types.h"
+
 // Includes from sli:
 #include "dictdatum.h"
 
@@ -50,6 +58,7 @@ public:
   virtual void get_status( DictionaryDatum& );       // get parameters
 
   IOManager(); // Construct only by meta-manager
+  ~IOManager();
 
   /**
    * The prefix for files written by devices.
@@ -75,10 +84,158 @@ public:
    */
   bool overwrite_files() const;
 
+  /**
+   * Indicate if recording devices write to the per-rank aggregate file.
+   * If true, devices recording to file do not open a file of their own,
+   * but pass their output in chunks to write_aggregate_chunk().
+   */
+  bool aggregate_recordings() const;
+
+  /**
+   * Indicate if recording devices write through the I/O thread.
+   * If true, devices recording to file collect their output in chunks,
+   * which are written to disk by a dedicated thread owned by the IOManager.
+   */
+  bool async_recordings() const;
+
+  /**
+   * Number of bytes a recording device collects before it passes a chunk
+   * to write_aggregate_chunk() or write_chunk().
+   */
+  size_t get_recording_chunk_size() const;
+
+  /**
+   * Name of the per-rank aggregate data file.
+   * The index file has the same name, with extension idx instead of dat.
+   */
+  std::string get_aggregate_filename() const;
+
+  /**
+   * Open aggregate data and index file, if not open already.
+   * Called by recording devices during calibration. Throws IOError if the
+   * files cannot be opened.
+   */
+  void open_aggregate_streams();
+
+  /**
+   * Append one chunk of recorded data to the aggregate file.
+   *
+   * The chunk is preceded by a binary header consisting of the device GID
+   * (uint64), the device VP (uint32), a reserved field (uint32) and the
+   * number of payload bytes (uint64). For every chunk, one line with GID,
+   * VP, offset of the payload in the data file, payload size and label
+   * is appended to the index file. The payload is exactly what the device
+   * would otherwise have written to its own file, so concatenating all
+   * chunks of one device in file order restores its data.
+   *
+   * If async_recordings() is true, the chunk is queued for the I/O thread.
+   * This function is thread-safe.
+   */
+  void write_aggregate_chunk( index gid,
+    thread vp,
+    const std::string& label,
+    const std::string& data );
+
+  /**
+   * Queue one chunk of recorded data for the file of a recording device.
+   *
+   * Only used if async_recordings() is true. The I/O thread writes the data
+   * to the given stream and flushes the stream afterwards if flush is true.
+   * The stream must not be accessed by the device before the next call to
+   * synchronize(). This function is thread-safe.
+   */
+  void write_chunk( std::ofstream& fs, const std::string& data, bool flush );
+
+  /**
+   * Start the I/O thread if required.
+   * Called at the beginning of each call to Prepare.
+   */
+  void prepare();
+
+  /**
+   * Wait until the I/O thread has written all queued chunks.
+   */
+  void synchronize();
+
+  /**
+   * Write all pending data and flush aggregate data and index file.
+   * Called at the end of each call to Run.
+   */
+  void post_run_cleanup();
+
 private:
+  /**
+   * Chunk of data queued for the I/O thread.
+   */
+  struct WriteRequest_
+  {
+    std::ofstream* fs_; //!< file of device, 0 for the aggregate file
+    index gid_;
+    thread vp_;
+    std::string label_;
+    std::string data_;
+    bool flush_; //!< flush fs_ after writing
+
+    WriteRequest_( std::ofstream*,
+      index,
+      thread,
+      const std::string&,
+      const std::string&,
+      bool );
+  };
+
+  //! Close aggregate data and index file
+  void close_aggregate_streams_();
+
+  //! Append chunk to aggregate file, caller must ensure exclusive access
+  void append_aggregate_chunk_( index gid,
+    thread vp,
+    const std::string& label,
+    const std::string& data );
+
+  /**
+   * Pass request to I/O thread, blocks while too much data is queued.
+   * The data of the request is swapped into the queue.
+   */
+  void enqueue_request_( WriteRequest_& );
+
+  void start_writer_(); //!< Start I/O thread, if not running
+  void stop_writer_();  //!< Write all pending data and stop I/O thread
+
+  //! Main loop of the I/O thread
+  void run_writer_();
+
+  //! Entry point of the I/O thread, arg is the IOManager
+  static void* writer_main_( void* arg );
+
   std::string data_path_;   //!< Path for all files written by devices
   std::string data_prefix_; //!< Prefix for all files written by devices
   bool overwrite_files_;    //!< If true, overwrite existing data files.
+
+  bool aggregate_recordings_;   //!< If true, devices write to aggregate file
+  size_t recording_chunk_size_; //!< Chunk size in bytes for aggregate file
+  std::ofstream aggregate_fs_;  //!< Per-rank aggregate data file
+  std::ofstream aggregate_index_fs_; //!< Index of chunks in aggregate_fs_
+  std::string aggregate_filename_;   //!< Name of open aggregate file
+
+  bool async_recordings_;          //!< If true, write through I/O thread
+  size_t recording_buffer_limit_;  //!< Max bytes queued before blocking
+  bool writer_running_;            //!< I/O thread has been started
+  bool writer_stop_;               //!< I/O thread shall terminate
+  bool writer_busy_;               //!< I/O thread is writing a batch
+  bool writer_error_;              //!< I/O thread encountered error
+  size_t queued_bytes_;            //!< Size of data in pending_requests_
+  pthread_t writer_thread_;        //!< The I/O thread
+  pthread_mutex_t writer_mutex_;   //!< Protects all writer_* members
+  pthread_cond_t writer_wakeup_;   //!< Signals new requests to I/O thread
+  pthread_cond_t writer_progress_; //!< Signals finished batches
+
+  /**
+   * Requests queued by the simulation threads.
+   * The I/O thread swaps this buffer with its own and writes the data,
+   * while simulation threads continue to fill the emptied buffer.
+   */
+  std::vector< WriteRequest_ > pending_requests_;
 };
 }
 
@@ -101,4 +258,22 @@ nest::IOManager::overwrite_files() const
   return overwrite_files_;
 }
 
+inline bool
+nest::IOManager::aggregate_recordings() const
+{
+  return aggregate_recordings_;
+}
+
+inline bool
+nest::IOManager::async_recordings() const
+{
+  return async_recordings_;
+}
+
+inline size_t
+nest::IOManager::get_recording_chunk_size() const
+{
+  return recording_chunk_size_;
+}
+
 #endif /* IO_MANAGER_H */
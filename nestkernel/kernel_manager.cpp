@@ -22,6 +22,18 @@
 
 #include "kernel_manager.h"
 
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "checkpoint.h"
+
+namespace
+{
+const std::string checkpoint_magic = "NESTCKPT";
+const unsigned int checkpoint_version = 1;
+}
+
 nest::KernelManager* nest::KernelManager::kernel_manager_instance_ = 0;
 
 void
@@ -201,3 +213,71 @@ nest::KernelManager::get_status( DictionaryDatum& dict )
 
   node_manager.get_status( dict );
 }
+
+void
+nest::KernelManager::save_checkpoint( const std::string& prefix )
+{
+  assert( is_initialized() );
+  CheckpointWriter writer(
+    checkpoint_file_name( prefix, mpi_manager.get_rank() ) );
+
+  writer.write( checkpoint_magic );
+  writer.write( checkpoint_version );
+  writer.write( mpi_manager.get_num_processes() );
+  writer.write( mpi_manager.get_rank() );
+  writer.write( vp_manager.get_num_threads() );
+  writer.write( Time::get_resolution().get_tics() );
+  writer.write( node_manager.size() );
+
+  rng_manager.save_state( writer );
+  connection_manager.save_connections( writer );
+  node_manager.save_nodes_state( writer );
+  event_delivery_manager.save_pending_spikes( writer );
+  simulation_manager.save_clock( writer );
+
+  writer.close();
+}
+
+void
+nest::KernelManager::restore_checkpoint( const std::string& prefix )
+{
+  assert( is_initialized() );
+  if ( simulation_manager.has_been_simulated()
+    or connection_manager.get_num_connections() > 0 )
+  {
+    throw KernelException(
+      "A checkpoint can only be restored to a network that has been neither "
+      "connected nor simulated." );
+  }
+
+  const std::string filename =
+    checkpoint_file_name( prefix, mpi_manager.get_rank() );
+  CheckpointReader reader( filename );
+
+  std::string magic;
+  unsigned int version = 0;
+  reader.read( magic );
+  reader.read( version );
+  if ( magic != checkpoint_magic or version != checkpoint_version )
+  {
+    throw BadProperty(
+      String::compose( "'%1' is not a valid checkpoint file.", filename ) );
+  }
+  reader.expect( mpi_manager.get_num_processes(), "number of processes" );
+  reader.expect( mpi_manager.get_rank(), "rank" );
+  reader.expect( vp_manager.get_num_threads(), "number of threads" );
+  reader.expect( Time::get_resolution().get_tics(), "resolution" );
+  reader.expect( node_manager.size(), "number of nodes" );
+
+  rng_manager.restore_state( reader );
+
+  // connections determine the delay extrema, which are needed to size the
+  // buffers of nodes and of pending spikes
+  connection_manager.restore_connections( reader );
+  node_manager.restore_nodes_state( reader );
+  event_delivery_manager.restore_pending_spikes( reader );
+
+  // restore the clock last, since connections cannot be created once the
+  // network counts as simulated
+  simulation_manager.restore_clock( reader );
+}
@@ -88,6 +88,15 @@
                                         (default is the current directory)
  data_prefix              stringtype  - A common prefix for all data files
  overwrite_files          booltype    - Whether to overwrite existing data files
+ aggregate_recordings     booltype    - Whether recording devices write to one
+                                        file per MPI process instead of one file
+                                        per device and virtual process
+ recording_chunk_size     integertype - Number of bytes a device collects before
+                                        writing to the aggregate file or I/O thread
+ async_recordings         booltype    - Whether recorded data is written to file
+                                        by a separate I/O thread
+ recording_buffer_limit   integertype - Number of bytes queued for the I/O thread
+                                        before recording devices block
  print_time               booltype    - Whether to print progress information during the simulation
 
  Network information
@@ -171,6 +180,34 @@ public:
   void set_status( const DictionaryDatum& );
   void get_status( DictionaryDatum& );
 
+  /**
+   * Write the state of the simulation to a checkpoint.
+   *
+   * Each process writes the file checkpoint_file_name( prefix, rank ),
+   * which contains the simulation clock, the states of all random
+   * generators, all local connections including their plastic state,
+   * the dynamic state of all local nodes and the spikes not delivered
+   * yet. Parameters of models and nodes are not stored.
+   *
+   * @throws IOError if a file cannot be written.
+   * @throws NotImplemented if a node does not support checkpoints.
+   * @see Node::save_state()
+   */
+  void save_checkpoint( const std::string& prefix );
+
+  /**
+   * Restore the state of the simulation from a checkpoint.
+   *
+   * The network must have been recreated with the same nodes, node
+   * parameters and kernel settings as when the checkpoint was written,
+   * but neither be connected nor simulated. The checkpoint must have been
+   * written with the same number of processes and threads.
+   *
+   * @throws IOError if a file cannot be read.
+   * @throws BadProperty if the checkpoint does not match the network.
+   */
+  void restore_checkpoint( const std::string& prefix );
+
   //! Returns true if kernel is initialized
   bool is_initialized() const;
 
@@ -194,6 +194,25 @@ get_connection_status( const ConnectionDatum& conn )
     conn.get_target_thread() );
 }
 
+std::vector< double >
+get_connection_property( const ConnectionArrays& connections,
+  const Name& name )
+{
+  std::vector< double > values;
+  kernel().connection_manager.get_synapse_property(
+    connections, name, values );
+  return values;
+}
+
+void
+set_connection_property( const ConnectionArrays& connections,
+  const Name& name,
+  const std::vector< double >& values )
+{
+  kernel().connection_manager.set_synapse_property(
+    connections, name, values );
+}
+
 index
 create( const Name& model_name, const index n_nodes )
 {
@@ -238,6 +257,31 @@ get_connections( const DictionaryDatum& dict )
   return array;
 }
 
+DictionaryDatum
+get_connection_arrays( const DictionaryDatum& dict )
+{
+  dict->clear_access_flags();
+
+  ConnectionArrays connections;
+  kernel().connection_manager.get_connections( connections, dict );
+
+  ALL_ENTRIES_ACCESSED(
+    *dict, "GetConnectionArrays", "Unread dictionary entries: " );
+
+  return connections.release_as_dict();
+}
+
+void
+dump_connectome( const std::string& prefix, const DictionaryDatum& dict )
+{
+  dict->clear_access_flags();
+
+  kernel().connection_manager.dump_connectome( prefix, dict );
+
+  ALL_ENTRIES_ACCESSED(
+    *dict, "DumpConnectome", "Unread dictionary entries: " );
+}
+
 void
 simulate( const double& time )
 {
@@ -296,6 +340,18 @@ cleanup()
   kernel().simulation_manager.cleanup();
 }
 
+void
+save_checkpoint( const std::string& prefix )
+{
+  kernel().save_checkpoint( prefix );
+}
+
+void
+restore_checkpoint( const std::string& prefix )
+{
+  kernel().restore_checkpoint( prefix );
+}
+
 void
 copy_model( const Name& oldmodname,
   const Name& newmodname,
@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <ostream>
+#include <string>
 
 // Includes from libnestutil:
 #include "logging.h"
@@ -71,6 +72,13 @@ void set_connection_status( const ConnectionDatum& conn,
   const DictionaryDatum& dict );
 DictionaryDatum get_connection_status( const ConnectionDatum& conn );
 
+std::vector< double > get_connection_property(
+  const ConnectionArrays& connections,
+  const Name& name );
+void set_connection_property( const ConnectionArrays& connections,
+  const Name& name,
+  const std::vector< double >& values );
+
 index create( const Name& model_name, const index n );
 
 void connect( const GIDCollection& sources,
@@ -80,6 +88,10 @@ void connect( const GIDCollection& sources,
 
 ArrayDatum get_connections( const DictionaryDatum& dict );
 
+DictionaryDatum get_connection_arrays( const DictionaryDatum& dict );
+
+void dump_connectome( const std::string& prefix, const DictionaryDatum& dict );
+
 void simulate( const double& t );
 void resume_simulation();
 /**
@@ -124,6 +136,22 @@ void prepare();
  */
 void cleanup();
 
+/**
+ * @fn save_checkpoint(const std::string& prefix)
+ * @brief write the state of the simulation to one file per process
+ *
+ * @see KernelManager::save_checkpoint()
+ */
+void save_checkpoint( const std::string& prefix );
+
+/**
+ * @fn restore_checkpoint(const std::string& prefix)
+ * @brief restore the state of the simulation written by save_checkpoint()
+ *
+ * @see KernelManager::restore_checkpoint()
+ */
+void restore_checkpoint( const std::string& prefix );
+
 void copy_model( const Name& oldmodname,
   const Name& newmodname,
   const DictionaryDatum& dict );
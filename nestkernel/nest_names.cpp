@@ -42,6 +42,7 @@ const Name Act_h( "Act_h" );
 const Name Act_m( "Act_m" );
 const Name activity( "activity" );
 const Name address( "address" );
+const Name aggregate_recordings( "aggregate_recordings" );
 const Name ahp_bug( "ahp_bug" );
 const Name allow_offgrid_spikes( "allow_offgrid_spikes" );
 const Name allow_offgrid_times( "allow_offgrid_times" );
@@ -57,6 +58,7 @@ const Name amplitude_values( "amplitude_values" );
 const Name Aplus( "Aplus" );
 const Name Aplus_triplet( "Aplus_triplet" );
 const Name archiver_length( "archiver_length" );
+const Name async_recordings( "async_recordings" );
 const Name available( "available" );
 const Name autapses( "autapses" );
 
@@ -64,6 +66,7 @@ const Name b( "b" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
 const Name binary( "binary" );
+const Name bin_width( "bin_width" );
 
 const Name c( "c" );
 const Name c_1( "c_1" );
@@ -90,6 +93,7 @@ const Name count_histogram( "count_histogram" );
 const Name covariance( "covariance" );
 const Name currents( "currents" );
 const Name customdict( "customdict" );
+const Name cvs( "cvs" );
 
 const Name d( "d" );
 const Name D_lower( "D_lower" );
@@ -243,6 +247,9 @@ const Name instantiations( "instantiations" );
 const Name Interpol_Order( "Interpol_Order" );
 const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
+const Name isi_bin_width( "isi_bin_width" );
+const Name isi_histogram( "isi_histogram" );
+const Name isi_max( "isi_max" );
 
 const Name Kplus( "Kplus" );
 const Name Kplus_triplet( "Kplus_triplet" );
@@ -265,6 +272,8 @@ const Name make_symmetric( "make_symmetric" );
 const Name max_delay( "max_delay" );
 const Name MAXERR( "MAXERR" );
 const Name mean( "mean" );
+const Name mean_cv( "mean_cv" );
+const Name mean_rate( "mean_rate" );
 const Name memory( "memory" );
 const Name message_times( "messages_times" );
 const Name messages( "messages" );
@@ -317,6 +326,7 @@ const Name parent( "parent" );
 const Name phase( "phase" );
 const Name phi( "phi" );
 const Name phi_th( "phi_th" );
+const Name population_counts( "population_counts" );
 const Name port( "port" );
 const Name ports( "ports" );
 const Name port_name( "port_name" );
@@ -341,6 +351,7 @@ const Name q_sfa( "q_sfa" );
 const Name q_stc( "q_stc" );
 
 const Name rate( "rate" );
+const Name rates( "rates" );
 const Name readout_cycle_duration( "readout_cycle_duration" );
 const Name receive_buffer_size( "receive_buffer_size" );
 const Name receptor_type( "receptor_type" );
@@ -350,6 +361,8 @@ const Name record_from( "record_from" );
 const Name record_to( "record_to" );
 const Name recordables( "recordables" );
 const Name recorder( "recorder" );
+const Name recording_buffer_limit( "recording_buffer_limit" );
+const Name recording_chunk_size( "recording_chunk_size" );
 const Name refractory_input( "refractory_input" );
 const Name registered( "registered" );
 const Name relative_amplitude( "relative_amplitude" );
@@ -379,6 +392,7 @@ const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name source( "source" );
 const Name spike( "spike" );
+const Name spike_counts( "spike_counts" );
 const Name spike_multiplicities( "spike_multiplicities" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
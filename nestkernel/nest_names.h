@@ -55,6 +55,7 @@ extern const Name Act_h;                //!< Specific to Hodgkin Huxley models
 extern const Name Act_m;                //!< Specific to Hodgkin Huxley models
 extern const Name activity;             //!< Used in pulsepacket_generator
 extern const Name address;              //!< Node parameter
+extern const Name aggregate_recordings; //!< Used in io_manager
 extern const Name ahp_bug;              //!< Used in iaf_chxk_2008
 extern const Name allow_offgrid_spikes; //!< Used in spike_generator
 extern const Name allow_offgrid_times;  //!< Used in step_current_generator
@@ -70,6 +71,7 @@ extern const Name amplitude_values; //!< Used by sted_current_generator
 extern const Name Aplus;            //!< Used by stdp_connection_facetshw_hom
 extern const Name Aplus_triplet;    //!< Used by stdp_connection_facetshw_hom
 extern const Name archiver_length;  //!< used for ArchivingNode
+extern const Name async_recordings;  //!< Used in io_manager
 extern const Name available;        //!< model paramater
 extern const Name autapses;         //!< Connectivity-related
 
@@ -78,6 +80,7 @@ extern const Name beta; //!< Specific to amat2_*
 extern const Name
   beta_Ca; //!< Increment in calcium concentration with each spike
 extern const Name binary; //!< Recorder parameter
+extern const Name bin_width; //!< Specific to spike_statistics_detector
 
 extern const Name c;         //!< Specific to Izhikevich 2003
 extern const Name c_1;       //!< Specific to stochastic neuron pp_psc_delta
@@ -108,6 +111,7 @@ extern const Name count_histogram;  //!< Specific to correlation_detector
 extern const Name covariance;       //!< Specific to correlomatrix_detector
 extern const Name currents;         //!< Recorder parameter
 extern const Name customdict;       //!< Used by Subnet
+extern const Name cvs; //!< Specific to spike_statistics_detector
 
 extern const Name d; //!< Specific to Izhikevich 2003
 extern const Name D_lower;
@@ -281,6 +285,9 @@ extern const Name
   Interpol_Order;           //!< Interpolation order (precise timing neurons)
 extern const Name interval; //!< Recorder parameter
 extern const Name is_refractory; //!< Neuron is in refractory period (debugging)
+extern const Name isi_bin_width; //!< Specific to spike_statistics_detector
+extern const Name isi_histogram; //!< Specific to spike_statistics_detector
+extern const Name isi_max;       //!< Specific to spike_statistics_detector
 
 extern const Name Kplus;         //!< Used by stdp_connection_facetshw_hom
 extern const Name Kplus_triplet; //!< Used by stdp_connection_facetshw_hom
@@ -305,6 +312,8 @@ extern const Name max_delay;      //!< In ConnBuilder
 extern const Name MAXERR; //!< Largest permissible error for adaptive stepsize
                           //!< (Brette & Gerstner 2005)
 extern const Name mean;   //!< Miscellaneous parameters
+extern const Name mean_cv;   //!< Specific to spike_statistics_detector
+extern const Name mean_rate; //!< Specific to spike_statistics_detector
 extern const Name memory; //!< Recorder parameter
 extern const Name message_times; //!< Used in music_message_in_proxy
 extern const Name messages;      //!< Used in music_message_in_proxy
@@ -361,6 +370,7 @@ extern const Name parent;                //!< Node parameter
 extern const Name phase;                 //!< Signal phase in degrees
 extern const Name phi;                   //!< Specific to mirollo_strogatz_ps
 extern const Name phi_th;                //!< Specific to mirollo_strogatz_ps
+extern const Name population_counts; //!< Specific to spike_statistics_detector
 extern const Name port;                  //!< Connection parameters
 extern const Name ports;                 //!< Recorder parameter
 extern const Name port_name;             //!< Parameters for MUSIC devices
@@ -386,6 +396,7 @@ extern const Name q_stc; //!< Specific to gif models
 
 extern const Name rate; //!< Specific to ppd_sup_generator,
                         //!< gamma_sup_generator and rate models
+extern const Name rates; //!< Specific to spike_statistics_detector
 extern const Name readout_cycle_duration; //!< Used by
                                           //!< stdp_connection_facetshw_hom
 extern const Name receive_buffer_size;    //!< mpi-related
@@ -397,6 +408,8 @@ extern const Name record_to;              //!< Recorder parameter
 extern const Name
   recordables; //!< List of recordable state data (Device parameters)
 extern const Name recorder; //!< Node type
+extern const Name recording_buffer_limit; //!< Used in io_manager
+extern const Name recording_chunk_size;   //!< Used in io_manager
 extern const Name
   refractory_input; //!< Spikes arriving during refractory period are counted
                     //!< (precise timing neurons)
@@ -432,6 +445,7 @@ extern const Name soma_inh;         //!< Used by iaf_cond_alpha_mc
 extern const Name source;           //!< Connection parameters
 extern const Name spike; //!< true if the neuron spikes and false if not.
                          //!< (sli_neuron)
+extern const Name spike_counts; //!< Specific to spike_statistics_detector
 extern const Name spike_multiplicities;           //!x Used by spike_generator
 extern const Name spike_times;                    //!< Recorder parameter
 extern const Name spike_weights;                  //!< Used by spike_generator
@@ -449,6 +449,104 @@ NestModule::GetConnections_DFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+void
+NestModule::GetConnectionArrays_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  DictionaryDatum dict = getValue< DictionaryDatum >( i->OStack.pick( 0 ) );
+
+  DictionaryDatum arrays = get_connection_arrays( dict );
+
+  i->OStack.pop();
+  i->OStack.push( arrays );
+  i->EStack.pop();
+}
+
+void
+NestModule::GetSynapseProperty_D_lFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  const ConnectionArrays connections(
+    getValue< DictionaryDatum >( i->OStack.pick( 1 ) ) );
+  const Name name = getValue< Name >( i->OStack.pick( 0 ) );
+
+  DoubleVectorDatum values(
+    new std::vector< double >( get_connection_property( connections, name ) ) );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( values );
+  i->EStack.pop();
+}
+
+void
+NestModule::GetSynapseProperty_a_lFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  const ConnectionArrays connections(
+    getValue< ArrayDatum >( i->OStack.pick( 1 ) ) );
+  const Name name = getValue< Name >( i->OStack.pick( 0 ) );
+
+  DoubleVectorDatum values(
+    new std::vector< double >( get_connection_property( connections, name ) ) );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( values );
+  i->EStack.pop();
+}
+
+void
+NestModule::SetSynapseProperty_D_l_aFunction::execute(
+  SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 3 );
+
+  const ConnectionArrays connections(
+    getValue< DictionaryDatum >( i->OStack.pick( 2 ) ) );
+  const Name name = getValue< Name >( i->OStack.pick( 1 ) );
+  const std::vector< double > values =
+    getValue< std::vector< double > >( i->OStack.pick( 0 ) );
+
+  set_connection_property( connections, name, values );
+
+  i->OStack.pop( 3 );
+  i->EStack.pop();
+}
+
+void
+NestModule::SetSynapseProperty_a_l_aFunction::execute(
+  SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 3 );
+
+  const ConnectionArrays connections(
+    getValue< ArrayDatum >( i->OStack.pick( 2 ) ) );
+  const Name name = getValue< Name >( i->OStack.pick( 1 ) );
+  const std::vector< double > values =
+    getValue< std::vector< double > >( i->OStack.pick( 0 ) );
+
+  set_connection_property( connections, name, values );
+
+  i->OStack.pop( 3 );
+  i->EStack.pop();
+}
+
+void
+NestModule::DumpConnectome_s_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 1 ) );
+  DictionaryDatum dict = getValue< DictionaryDatum >( i->OStack.pick( 0 ) );
+
+  dump_connectome( prefix, dict );
+
+  i->OStack.pop( 2 );
+  i->EStack.pop();
+}
+
 /* BeginDocumentation
    Name: Simulate - simulate n milliseconds
 
@@ -551,6 +649,98 @@ NestModule::CleanupFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/* BeginDocumentation
+   Name: SaveCheckpoint - write the state of the simulation to files
+
+   Synopsis:
+   (prefix) SaveCheckpoint -> -
+
+   Parameters:
+   prefix - path and prefix of the file names
+
+   Description:
+   Each MPI process writes the state of its part of the simulation to the
+   binary file prefix-<rank>.ckpt. The checkpoint contains the simulation
+   time, the states of all random number generators, all connections
+   including their weights and plastic state, the dynamic state of all
+   neurons including their spike history, and all spikes that have not
+   been delivered yet.
+
+   Parameters of models and nodes are not stored. To continue a
+   simulation from a checkpoint, recreate the nodes with the same
+   parameters and kernel settings and call RestoreCheckpoint.
+
+   Remarks:
+   Checkpoints are supported by the neuron models iaf_psc_alpha,
+   iaf_psc_delta, iaf_psc_exp and parrot_neuron, and by the synapse
+   models static_synapse, static_synapse_compact, static_synapse_hom_w,
+   stdp_synapse and stdp_synapse_hom and their _hpc variants.
+   SaveCheckpoint raises NotImplemented for other neuron and synapse
+   models, and for stimulating devices with dynamic state, such as
+   noise_generator, step_current_generator or spike_generator.
+   Generators without dynamic state, such as poisson_generator or
+   dc_generator, are supported. Recording devices are not stored, so they
+   start with empty recordings after a restore. Synaptic elements for
+   structural plasticity are not stored.
+   Checkpoints can only be read by the same NEST binary on the same kind
+   of machine.
+
+   SeeAlso: RestoreCheckpoint, Simulate
+*/
+void
+NestModule::SaveCheckpoint_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  save_checkpoint( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
+/* BeginDocumentation
+   Name: RestoreCheckpoint - restore the state of the simulation from files
+
+   Synopsis:
+   (prefix) RestoreCheckpoint -> -
+
+   Parameters:
+   prefix - path and prefix of the file names given to SaveCheckpoint
+
+   Description:
+   Restores the state written by SaveCheckpoint. The nodes must have been
+   recreated with the same models, parameters and kernel settings as
+   when the checkpoint was written, but they must neither be connected
+   nor simulated. The connections are restored from the checkpoint.
+   The number of MPI processes and threads must be the same as when
+   the checkpoint was written.
+
+   Example:
+   /iaf_psc_alpha 100 Create ;
+   ...
+   1000 Simulate
+   (/tmp/state) SaveCheckpoint
+
+   ResetKernel
+   /iaf_psc_alpha 100 Create ;
+   (/tmp/state) RestoreCheckpoint
+   1000 Simulate
+
+   SeeAlso: SaveCheckpoint, ResetKernel
+*/
+void
+NestModule::RestoreCheckpoint_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string prefix = getValue< std::string >( i->OStack.pick( 0 ) );
+  restore_checkpoint( prefix );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
 /* BeginDocumentation
    Name: CopyModel - copy a model to a new name, set parameters for copy, if
    given
@@ -1728,12 +1918,22 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "GetStatus_a", &getstatus_afunction );
 
   i->createcommand( "GetConnections_D", &getconnections_Dfunction );
+  i->createcommand( "GetConnectionArrays_D", &getconnectionarrays_Dfunction );
+  i->createcommand( "GetSynapseProperty_D_l", &getsynapseproperty_D_lfunction );
+  i->createcommand( "GetSynapseProperty_a_l", &getsynapseproperty_a_lfunction );
+  i->createcommand(
+    "SetSynapseProperty_D_l_a", &setsynapseproperty_D_l_afunction );
+  i->createcommand(
+    "SetSynapseProperty_a_l_a", &setsynapseproperty_a_l_afunction );
+  i->createcommand( "DumpConnectome_s_D", &dumpconnectome_s_Dfunction );
   i->createcommand( "cva_C", &cva_cfunction );
 
   i->createcommand( "Simulate_d", &simulatefunction );
   i->createcommand( "Run_d", &runfunction );
   i->createcommand( "Prepare", &preparefunction );
   i->createcommand( "Cleanup", &cleanupfunction );
+  i->createcommand( "SaveCheckpoint_s", &savecheckpoint_sfunction );
+  i->createcommand( "RestoreCheckpoint_s", &restorecheckpoint_sfunction );
 
   i->createcommand( "CopyModel_l_l_D", &copymodel_l_l_Dfunction );
   i->createcommand( "SetDefaults_l_D", &setdefaults_l_Dfunction );
@@ -1808,6 +2008,8 @@ NestModule::init( SLIInterpreter* i )
     "pairwise_bernoulli" );
   kernel().connection_manager.register_conn_builder< FixedTotalNumberBuilder >(
     "fixed_total_number" );
+  kernel().connection_manager.register_conn_builder< FromFileBuilder >(
+    "from_file" );
 
   // Add MSP growth curves
   kernel().sp_manager.register_growth_curve< GrowthCurveSigmoid >( "sigmoid" );
@@ -225,6 +225,42 @@ public:
     void execute( SLIInterpreter* ) const;
   } getconnections_Dfunction;
 
+  class GetConnectionArrays_DFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getconnectionarrays_Dfunction;
+
+  class GetSynapseProperty_D_lFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getsynapseproperty_D_lfunction;
+
+  class GetSynapseProperty_a_lFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getsynapseproperty_a_lfunction;
+
+  class SetSynapseProperty_D_l_aFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } setsynapseproperty_D_l_afunction;
+
+  class SetSynapseProperty_a_l_aFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } setsynapseproperty_a_l_afunction;
+
+  class DumpConnectome_s_DFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } dumpconnectome_s_Dfunction;
+
   class SimulateFunction : public SLIFunction
   {
   public:
@@ -249,6 +285,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } cleanupfunction;
 
+  class SaveCheckpoint_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } savecheckpoint_sfunction;
+
+  class RestoreCheckpoint_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } restorecheckpoint_sfunction;
+
   class Create_l_iFunction : public SLIFunction
   {
   public:
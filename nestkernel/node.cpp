@@ -115,6 +115,13 @@ Node::get_model_() const
   return *kernel().model_manager.get_model( model_id_ );
 }
 
+void
+Node::checkpoint_not_supported_() const
+{
+  throw NotImplemented(
+    String::compose( "Model %1 does not support checkpoints.", get_name() ) );
+}
+
 bool
 Node::is_local() const
 {
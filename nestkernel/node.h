@@ -50,6 +50,8 @@ namespace nest
 class Model;
 class Subnet;
 class Archiving_Node;
+class CheckpointWriter;
+class CheckpointReader;
 
 
 /**
@@ -309,6 +311,20 @@ public:
   {
   }
 
+  /**
+   * Collect data across threads and processes after Run. Override this
+   * function if a device replicated on all virtual processes needs to
+   * combine the data of its thread siblings and exchange it between MPI
+   * processes. It is called after post_run_cleanup() on the sibling on
+   * thread 0 only, outside of any parallel region and for all replicated
+   * nodes in the same order on all processes, so that MPI collectives
+   * may be used.
+   */
+  virtual void
+  post_run_collect()
+  {
+  }
+
   /**
    * Finalize node.
    * Override this function if a node needs to "wrap up" things after a
@@ -384,6 +400,32 @@ public:
    */
   virtual void get_status( DictionaryDatum& ) const = 0;
 
+  /**
+   * Store the dynamic state of the node in a checkpoint.
+   * Parameters are not stored, since the node is recreated by the
+   * simulation script before restore_state() is called. The default
+   * stores nothing, which is only correct for nodes without dynamic state.
+   * Models with dynamic state must override save_state() and
+   * restore_state(), and call checkpoint_not_supported_() in them until
+   * they store their state.
+   * @see KernelManager::save_checkpoint()
+   * @ingroup status_interface
+   */
+  virtual void
+  save_state( CheckpointWriter& ) const
+  {
+  }
+
+  /**
+   * Restore the dynamic state stored by save_state().
+   * The buffers of the node are initialized before this is called.
+   * @ingroup status_interface
+   */
+  virtual void
+  restore_state( CheckpointReader& )
+  {
+  }
+
 public:
   /**
    * @defgroup event_interface Communication.
@@ -900,6 +942,12 @@ protected:
 
   Model& get_model_() const;
 
+  /**
+   * Throw NotImplemented, for save_state() and restore_state() of models
+   * with dynamic state that is not stored in checkpoints.
+   */
+  void checkpoint_not_supported_() const;
+
   //! Mark node as frozen.
   void
   set_frozen_( bool frozen )
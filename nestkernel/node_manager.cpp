@@ -30,6 +30,7 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "event_delivery_manager.h"
 #include "genericmodel.h"
 #include "genericmodel_impl.h"
@@ -129,6 +130,9 @@ NodeManager::initialize()
 void
 NodeManager::finalize()
 {
+  // recording devices must not be destroyed while the I/O thread
+  // is still writing to their files
+  kernel().io_manager.synchronize();
   destruct_nodes_();
 }
 
@@ -881,6 +885,17 @@ NodeManager::post_run_cleanup()
       }
     }
   }
+
+  // replicated nodes exist on all processes, so they can combine their
+  // data using collective communication
+  for ( size_t idx = 0; idx < local_nodes_.size(); ++idx )
+  {
+    Node* node = local_nodes_.get_node_by_index( idx );
+    if ( node != 0 and node->num_thread_siblings() > 0 )
+    {
+      node->get_thread_sibling( 0 )->post_run_collect();
+    }
+  }
 }
 
 /**
@@ -1022,6 +1037,42 @@ NodeManager::set_status( const DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::save_nodes_state( CheckpointWriter& writer )
+{
+  ensure_valid_thread_local_ids();
+  for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    const std::vector< Node* >& nodes = get_nodes_on_thread( t );
+    writer.write< size_t >( nodes.size() );
+    for ( size_t n = 0; n < nodes.size(); ++n )
+    {
+      writer.write< index >( nodes[ n ]->get_gid() );
+      writer.write< int >( nodes[ n ]->get_model_id() );
+      nodes[ n ]->save_state( writer );
+    }
+  }
+}
+
+void
+NodeManager::restore_nodes_state( CheckpointReader& reader )
+{
+  ensure_valid_thread_local_ids();
+  for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    const std::vector< Node* >& nodes = get_nodes_on_thread( t );
+    reader.expect< size_t >( nodes.size(), "number of nodes" );
+    for ( size_t n = 0; n < nodes.size(); ++n )
+    {
+      reader.expect< index >( nodes[ n ]->get_gid(), "number of nodes" );
+      reader.expect< int >( nodes[ n ]->get_model_id(), "model of nodes" );
+      nodes[ n ]->set_buffers_initialized( false );
+      nodes[ n ]->init_buffers();
+      nodes[ n ]->restore_state( reader );
+    }
+  }
+}
+
 void
 NodeManager::reset_nodes_state()
 {
@@ -45,6 +45,8 @@ class SiblingContainer;
 class Node;
 class Subnet;
 class Model;
+class CheckpointWriter;
+class CheckpointReader;
 
 class NodeManager : public ManagerInterface
 {
@@ -107,6 +109,19 @@ public:
    */
   void reset_nodes_state();
 
+  /**
+   * Store the dynamic state of all local nodes in a checkpoint.
+   * @see Node::save_state()
+   */
+  void save_nodes_state( CheckpointWriter& );
+
+  /**
+   * Restore the state stored by save_nodes_state(). The buffers of all
+   * nodes are initialized before their state is restored.
+   * @throws BadProperty if the nodes differ from those in the checkpoint.
+   */
+  void restore_nodes_state( CheckpointReader& );
+
   /**
    * Set the state (observable dynamic variables) of a node to model defaults.
    * @see Node::init_state()
@@ -467,6 +467,9 @@ nest::RecordingDevice::Buffers_::Buffers_()
   : fs_()
   , fbuffer_( 0 )
   , fbuffer_size_( -1 )
+  , aggregate_( false )
+  , buffered_( false )
+  , chunk_()
 {
 }
 
@@ -558,8 +561,27 @@ nest::RecordingDevice::calibrate()
 {
   Device::calibrate();
 
-  if ( P_.to_file_ )
+  if ( P_.to_file_ and kernel().io_manager.aggregate_recordings() )
+  {
+    // output is collected in chunks and written to the aggregate file
+    if ( B_.fs_.is_open() )
+    {
+      B_.fs_.close();
+    }
+    kernel().io_manager.open_aggregate_streams();
+    P_.filename_ = kernel().io_manager.get_aggregate_filename() + ".dat";
+
+    B_.aggregate_ = true;
+    B_.buffered_ = true;
+    B_.chunk_.str( "" );
+  }
+  else if ( P_.to_file_ )
   {
+    // with the I/O thread, output is collected in chunks and written by it
+    B_.aggregate_ = false;
+    B_.buffered_ = kernel().io_manager.async_recordings();
+    B_.chunk_.str( "" );
+
     // do we need to (re-)open the file
     bool newfile = false;
 
@@ -679,7 +701,10 @@ nest::RecordingDevice::calibrate()
       P_.filename_.clear();
       throw IOError();
     }
+  }
 
+  if ( P_.to_file_ )
+  {
     /* Set formatting
        Formatting is not applied to std::cout for screen output,
        since different devices may have different settings and
@@ -687,20 +712,33 @@ nest::RecordingDevice::calibrate()
      */
     if ( P_.scientific_ )
     {
-      B_.fs_ << std::scientific;
+      file_stream_() << std::scientific;
     }
     else
     {
-      B_.fs_ << std::fixed;
+      file_stream_() << std::fixed;
     }
 
-    B_.fs_ << std::setprecision( P_.precision_ );
+    file_stream_() << std::setprecision( P_.precision_ );
   }
 }
 
 void
 nest::RecordingDevice::post_run_cleanup()
 {
+  if ( B_.buffered_ )
+  {
+    // the IOManager flushes the aggregate file after all devices are done
+    write_chunk_( P_.flush_after_simulate_ );
+
+    // the I/O thread may still be writing to our file, the IOManager
+    // reports errors once it has finished
+    if ( not B_.aggregate_ )
+    {
+      return;
+    }
+  }
+
   if ( B_.fs_.is_open() )
   {
     if ( P_.flush_after_simulate_ )
@@ -822,19 +860,17 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
 
   if ( P_.to_file_ )
   {
-    print_id_( B_.fs_, sender );
-    print_target_( B_.fs_, target );
-    print_port_( B_.fs_, port );
-    print_rport_( B_.fs_, rport );
-    print_time_( B_.fs_, stamp, offset );
-    print_weight_( B_.fs_, weight );
+    std::ostream& os = file_stream_();
+    print_id_( os, sender );
+    print_target_( os, target );
+    print_port_( os, port );
+    print_rport_( os, rport );
+    print_time_( os, stamp, offset );
+    print_weight_( os, weight );
     if ( endrecord )
     {
-      B_.fs_ << '\n';
-      if ( P_.flush_records_ )
-      {
-        B_.fs_.flush();
-      }
+      os << '\n';
+      end_file_record_();
     }
   }
 
@@ -846,6 +882,41 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
   }
 }
 
+void
+nest::RecordingDevice::end_file_record_()
+{
+  if ( B_.buffered_ )
+  {
+    if ( P_.flush_records_
+      or static_cast< size_t >( B_.chunk_.tellp() )
+        >= kernel().io_manager.get_recording_chunk_size() )
+    {
+      write_chunk_( P_.flush_records_ );
+    }
+  }
+  else if ( P_.flush_records_ )
+  {
+    B_.fs_.flush();
+  }
+}
+
+void
+nest::RecordingDevice::write_chunk_( bool flush )
+{
+  if ( B_.aggregate_ )
+  {
+    const std::string label =
+      P_.label_.empty() ? node_.get_name() : P_.label_;
+    kernel().io_manager.write_aggregate_chunk(
+      node_.get_gid(), node_.get_vp(), label, B_.chunk_.str() );
+  }
+  else
+  {
+    kernel().io_manager.write_chunk( B_.fs_, B_.chunk_.str(), flush );
+  }
+  B_.chunk_.str( "" );
+}
+
 void
 nest::RecordingDevice::print_id_( std::ostream& os, index gid )
 {
@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <fstream>
+#include <sstream>
 #include <vector>
 
 // Includes from libnestutil:
@@ -150,6 +151,18 @@ namespace nest
   /use_gid_in_filename - Determines if the GID is used in the file name of the
   recording device. Setting this to false can lead to conflicting file names.
 
+  If /aggregate_recordings is set to true in the root node, devices do not
+  open a file of their own. Instead, all devices on an MPI process collect
+  their output in chunks of /recording_chunk_size bytes and write them to
+  the file data_path/data_prefixrecordings-rank.dat. An index of all chunks
+  with GID, VP, offset and size is written to the file with extension .idx.
+  /filenames then contains the name of the aggregate file.
+
+  If /async_recordings is set to true in the root node, devices collect their
+  file output in chunks, which are written to disk by a dedicated I/O thread.
+  Simulation threads only block if more than /recording_buffer_limit bytes
+  are waiting to be written. All data is written before Simulate returns.
+
   The following parameters control how output is formatted:
   /withtime      - boolean value which specifies whether the network time should
                    be recorded (default: true).
@@ -464,6 +477,26 @@ private:
    */
   void flush_stream_();
 
+  /**
+   * Stream to which output to file is written.
+   * This is the file stream of the device, or the chunk buffer if
+   * recordings are aggregated per MPI process or written by the I/O thread.
+   */
+  std::ostream& file_stream_();
+
+  /**
+   * Mark end of record in file output.
+   * Flushes the file stream if requested. If output is buffered, the
+   * chunk buffer is passed on to the IOManager once it is full.
+   */
+  void end_file_record_();
+
+  /**
+   * Pass data collected in the chunk buffer to the IOManager.
+   * @param flush flush the file of the device after writing the chunk
+   */
+  void write_chunk_( bool flush );
+
   /**
    * Build filename from parts.
    * @note This function returns the filename, it does not manipulate
@@ -486,6 +519,10 @@ private:
     char* fbuffer_;
     long fbuffer_size_; //!< size of fbuffer_; -1: not yet set
 
+    bool aggregate_;           //!< true if output goes to aggregate file
+    bool buffered_;            //!< true if output is collected in chunk_
+    std::ostringstream chunk_; //!< output not yet passed to IOManager
+
     Buffers_();
     ~Buffers_();
   };
@@ -619,6 +656,16 @@ RecordingDevice::get_status( DictionaryDatum& d ) const
   ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
 }
 
+inline std::ostream&
+RecordingDevice::file_stream_()
+{
+  if ( B_.buffered_ )
+  {
+    return B_.chunk_;
+  }
+  return B_.fs_;
+}
+
 inline void
 RecordingDevice::set_precise_times( bool use_precise )
 {
@@ -647,10 +694,12 @@ RecordingDevice::print_value( const ValueT& value, bool endrecord )
 
   if ( P_.to_file_ )
   {
-    B_.fs_ << value << '\t';
+    std::ostream& os = file_stream_();
+    os << value << '\t';
     if ( endrecord )
     {
-      B_.fs_ << '\n';
+      os << '\n';
+      end_file_record_();
     }
   }
 }
@@ -22,6 +22,10 @@
 
 #include "ring_buffer.h"
 
+// Includes from nestkernel:
+#include "checkpoint.h"
+#include "exceptions.h"
+
 nest::RingBuffer::RingBuffer()
   : buffer_( kernel().connection_manager.get_min_delay()
         + kernel().connection_manager.get_max_delay(),
@@ -48,6 +52,23 @@ nest::RingBuffer::clear()
   buffer_.assign( buffer_.size(), 0.0 );
 }
 
+void
+nest::RingBuffer::save( CheckpointWriter& writer ) const
+{
+  writer.write_vector( buffer_ );
+}
+
+void
+nest::RingBuffer::restore( CheckpointReader& reader )
+{
+  const size_t size = buffer_.size();
+  reader.read_vector( buffer_ );
+  if ( buffer_.size() != size )
+  {
+    throw BadProperty( "The ring buffer size differs from the checkpoint." );
+  }
+}
+
 
 nest::MultRBuffer::MultRBuffer()
   : buffer_( kernel().connection_manager.get_min_delay()
@@ -34,6 +34,8 @@
 
 namespace nest
 {
+class CheckpointWriter;
+class CheckpointReader;
 
 /**
    Buffer Layout.
@@ -133,6 +135,15 @@ public:
     return buffer_.size();
   }
 
+  //! Store the buffered data in a checkpoint.
+  void save( CheckpointWriter& ) const;
+
+  /**
+   * Restore the buffered data from a checkpoint.
+   * @throws BadProperty if the buffer size differs.
+   */
+  void restore( CheckpointReader& );
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
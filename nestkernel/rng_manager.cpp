@@ -33,6 +33,7 @@
 #include "random_datums.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "vp_manager_impl.h"
@@ -307,3 +308,31 @@ nest::RNGManager::create_grng_()
   grng_seed_ = s;
   grng_->seed( s );
 }
+
+void
+nest::RNGManager::save_state( CheckpointWriter& writer ) const
+{
+  std::vector< unsigned long > state;
+  writer.write< size_t >( rng_.size() );
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    rng_[ t ]->get_state( state );
+    writer.write_vector( state );
+  }
+  grng_->get_state( state );
+  writer.write_vector( state );
+}
+
+void
+nest::RNGManager::restore_state( CheckpointReader& reader )
+{
+  std::vector< unsigned long > state;
+  reader.expect< size_t >( rng_.size(), "number of random generators" );
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    reader.read_vector( state );
+    rng_[ t ]->set_state( state );
+  }
+  reader.read_vector( state );
+  grng_->set_state( state );
+}
@@ -41,6 +41,8 @@
 
 namespace nest
 {
+class CheckpointWriter;
+class CheckpointReader;
 
 class RNGManager : public ManagerInterface
 {
@@ -71,6 +73,18 @@ public:
    */
   librandom::RngPtr get_grng() const;
 
+  /**
+   * Store the state of all random generators in a checkpoint.
+   * @throws UnsuitableRNG if a generator does not support this.
+   */
+  void save_state( CheckpointWriter& ) const;
+
+  /**
+   * Restore the state of all random generators from a checkpoint.
+   * @throws UnsuitableRNG if the generators differ from the checkpoint.
+   */
+  void restore_state( CheckpointReader& );
+
 private:
   void create_rngs_();
   void create_grng_();
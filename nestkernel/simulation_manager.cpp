@@ -32,6 +32,7 @@
 #include "compose.hpp"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "kernel_manager.h"
 #include "sibling_container.h"
 
@@ -416,6 +417,9 @@ nest::SimulationManager::prepare()
     kernel().event_delivery_manager.configure_spike_buffers();
   }
 
+  // start the I/O thread before devices prepare their output
+  kernel().io_manager.prepare();
+
   kernel().node_manager.ensure_valid_thread_local_ids();
   kernel().node_manager.prepare_nodes();
 
@@ -537,6 +541,7 @@ nest::SimulationManager::run( Time const& t )
   call_update_();
 
   kernel().node_manager.post_run_cleanup();
+  kernel().io_manager.post_run_cleanup();
 }
 
 void
@@ -924,6 +929,27 @@ nest::SimulationManager::reset_network()
     "This will be implemented in a future version of NEST." );
 }
 
+void
+nest::SimulationManager::save_clock( CheckpointWriter& writer ) const
+{
+  writer.write( clock_.get_steps() );
+  writer.write( slice_ );
+  writer.write( from_step_ );
+  writer.write( to_step_ );
+}
+
+void
+nest::SimulationManager::restore_clock( CheckpointReader& reader )
+{
+  delay steps = 0;
+  reader.read( steps );
+  reader.read( slice_ );
+  reader.read( from_step_ );
+  reader.read( to_step_ );
+  clock_ = Time::step( steps );
+  simulated_ = true;
+}
+
 void
 nest::SimulationManager::advance_time_()
 {
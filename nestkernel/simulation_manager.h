@@ -39,6 +39,8 @@
 namespace nest
 {
 class Node;
+class CheckpointWriter;
+class CheckpointReader;
 
 class SimulationManager : public ManagerInterface
 {
@@ -136,6 +138,17 @@ public:
    */
   void reset_network();
 
+  /**
+   * Store the simulation clock in a checkpoint.
+   */
+  void save_clock( CheckpointWriter& ) const;
+
+  /**
+   * Restore the simulation clock from a checkpoint. Afterwards, the
+   * SimulationManager counts as having been simulated.
+   */
+  void restore_clock( CheckpointReader& );
+
   /**
    * Get slice number. Increased by one for each slice. Can be used
    * to choose alternating buffers.
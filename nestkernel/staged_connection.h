@@ -0,0 +1,80 @@
+/*
+ *  staged_connection.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STAGED_CONNECTION_H
+#define STAGED_CONNECTION_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+class Node;
+
+/**
+ * Connection collected by ConnectionManager::stage_connection().
+ *
+ * Staged connections are created by
+ * ConnectionManager::flush_staged_connections(), which passes all staged
+ * connections of a source to ConnectorModel::add_connections() at once.
+ */
+struct StagedConnection
+{
+  index sgid_;      //!< GID of the source
+  Node* target_;    //!< target node on the thread of the connection
+  synindex syn_id_; //!< synapse type
+  double delay_;    //!< delay, numerics::nan for the default delay
+  double weight_;   //!< weight, numerics::nan for the default weight
+
+  StagedConnection( index sgid,
+    Node* target,
+    synindex syn_id,
+    double delay,
+    double weight )
+    : sgid_( sgid )
+    , target_( target )
+    , syn_id_( syn_id )
+    , delay_( delay )
+    , weight_( weight )
+  {
+  }
+
+  /**
+   * Order by source only, so that stable sorting preserves the order in
+   * which the connections of a source were staged.
+   */
+  bool
+  operator<( const StagedConnection& other ) const
+  {
+    return sgid_ < other.sgid_;
+  }
+};
+
+typedef std::vector< StagedConnection > StagedConnections;
+
+} // namespace nest
+
+#endif /* STAGED_CONNECTION_H */
@@ -135,9 +135,8 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::init()
     static_cast< long >( std::ceil( kernel().connection_manager.get_min_delay()
       / static_cast< double >( rec_int_steps_ ) ) );
 
-  data_.resize( 2,
-    DataLoggingReply::Container(
-                  recs_per_slice, DataLoggingReply::Item( num_vars_ ) ) );
+  data_.resize(
+    2, DataLoggingReply::Container( recs_per_slice, num_vars_ ) );
 
   next_rec_.resize( 2 );               // just for safety's sake
   next_rec_[ 0 ] = next_rec_[ 1 ] = 0; // start at beginning of buffer
@@ -168,15 +167,16 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::record_data(
    */
   assert( next_rec_[ wt ] < data_[ wt ].size() );
 
-  DataLoggingReply::Item& dest = data_[ wt ][ next_rec_[ wt ] ];
+  DataLoggingReply::Container& buffer = data_[ wt ];
 
   // set time stamp: step is left end of update interval, so add 1
-  dest.timestamp = Time::step( step + 1 );
+  buffer.timestamps[ next_rec_[ wt ] ] = Time::step( step + 1 );
 
   // obtain data through access functions, calling via pointer-to-member
+  double* const dest = buffer.row( next_rec_[ wt ] );
   for ( size_t j = 0; j < num_vars_; ++j )
   {
-    dest.data[ j ] = ( ( host ).*( node_access_[ j ] ) )();
+    dest[ j ] = ( ( host ).*( node_access_[ j ] ) )();
   }
 
   next_rec_step_ += rec_int_steps_;
@@ -206,13 +206,13 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::handle( HostNode& host,
 
   // get read toggle and start and end of slice
   const size_t rt = kernel().event_delivery_manager.read_toggle();
-  assert( not data_[ rt ].empty() );
+  assert( data_[ rt ].size() > 0 );
 
   // Check if we have valid data, i.e., data with time stamps within the
   // past time slice. This may not be the case if the node has been frozen.
   // In that case, we still reset the recording marker, to prepare for the next
   // round.
-  if ( data_[ rt ][ 0 ].timestamp
+  if ( data_[ rt ].timestamps[ 0 ]
     <= kernel().simulation_manager.get_previous_slice_origin() )
   {
     next_rec_[ rt ] = 0;
@@ -226,7 +226,7 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::handle( HostNode& host,
   // to -infinity after each call to this function.
   if ( next_rec_[ rt ] < data_[ rt ].size() )
   {
-    data_[ rt ][ next_rec_[ rt ] ].timestamp = Time::neg_inf();
+    data_[ rt ].timestamps[ next_rec_[ rt ] ] = Time::neg_inf();
   }
 
   // now create reply event and rigg it
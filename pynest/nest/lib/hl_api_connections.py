@@ -94,6 +94,214 @@ def GetConnections(source=None, target=None, synapse_model=None,
     return spp()
 
 
+@check_stack
+def GetConnectionArrays(source=None, target=None, synapse_model=None,
+                        synapse_label=None):
+    """Return connection identifiers as arrays of columns.
+
+    The connections are selected as in GetConnections, but instead of
+    one tuple per connection, a dictionary with one numpy array per
+    entry of the connection identifier is returned. This is much faster
+    than GetConnections for large numbers of connections.
+
+    Parameters
+    ----------
+    source : list, optional
+        Source GIDs, only connections from these
+        pre-synaptic neurons are returned
+    target : list, optional
+        Target GIDs, only connections to these
+        post-synaptic neurons are returned
+    synapse_model : str, optional
+        Only connections with this synapse type are returned
+    synapse_label : int, optional
+        (non-negative) only connections with this synapse label are returned
+
+    Returns
+    -------
+    dict:
+        Arrays 'source', 'target', 'target_thread', 'synapse_modelid'
+        and 'port', entry i of all arrays describes connection i
+
+    Notes
+    -----
+    Only connections with targets on the MPI process executing
+    the command are returned. Connections are ordered by synapse
+    model, thread and source.
+
+    Raises
+    ------
+    TypeError
+        Description
+    """
+
+    params = {}
+
+    if source is not None:
+        if not is_coercible_to_sli_array(source):
+            raise TypeError("source must be a list of GIDs")
+        params['source'] = numpy.asarray(source, dtype=numpy.int64)
+
+    if target is not None:
+        if not is_coercible_to_sli_array(target):
+            raise TypeError("target must be a list of GIDs")
+        params['target'] = numpy.asarray(target, dtype=numpy.int64)
+
+    if synapse_model is not None:
+        params['synapse_model'] = kernel.SLILiteral(synapse_model)
+
+    if synapse_label is not None:
+        params['synapse_label'] = synapse_label
+
+    sps(params)
+    sr("GetConnectionArrays")
+
+    return spp()
+
+
+def IterConnectionArrays(chunk_size, source=None, target=None,
+                         synapse_model=None, synapse_label=None):
+    """Iterate over the connections in chunks of source GIDs.
+
+    Yields the result of GetConnectionArrays for chunk_size sources at a
+    time, so that the connections of large networks can be processed
+    without holding all of them in memory at once.
+
+    Parameters
+    ----------
+    chunk_size : int
+        Number of source GIDs per chunk
+    source : list, optional
+        Source GIDs, all nodes of the network if not given
+    target : list, optional
+        Target GIDs, only connections to these
+        post-synaptic neurons are returned
+    synapse_model : str, optional
+        Only connections with this synapse type are returned
+    synapse_label : int, optional
+        (non-negative) only connections with this synapse label are returned
+
+    Returns
+    -------
+    generator:
+        Dictionaries of arrays as returned by GetConnectionArrays
+    """
+
+    if chunk_size < 1:
+        raise ValueError("chunk_size must be positive")
+
+    if source is None:
+        source = numpy.arange(1, GetKernelStatus('network_size'))
+    else:
+        source = numpy.unique(numpy.asarray(source, dtype=numpy.int64))
+
+    for start in range(0, len(source), chunk_size):
+        yield GetConnectionArrays(source[start:start + chunk_size], target,
+                                  synapse_model, synapse_label)
+
+
+@check_stack
+def GetSynapseProperty(conns, name):
+    """Return one property of many connections as an array.
+
+    Unlike GetStatus, no dictionary is created per connection.
+
+    Parameters
+    ----------
+    conns : dict or list
+        Connections as returned by GetConnectionArrays or GetConnections
+    name : str
+        Name of a numeric connection property, e.g. 'weight' or 'delay'
+
+    Returns
+    -------
+    numpy.ndarray:
+        Value of the property for each connection
+    """
+
+    sps(conns)
+    sps(kernel.SLILiteral(name))
+    sr("GetSynapseProperty")
+
+    return spp()
+
+
+@check_stack
+def SetSynapseProperty(conns, name, values):
+    """Set one property of many connections.
+
+    Unlike SetStatus, no dictionary is needed per connection.
+
+    Parameters
+    ----------
+    conns : dict or list
+        Connections as returned by GetConnectionArrays or GetConnections
+    name : str
+        Name of a numeric connection property, e.g. 'weight' or 'delay'
+    values : float or list
+        One value per connection or a single value for all connections
+    """
+
+    sps(conns)
+    sps(kernel.SLILiteral(name))
+    sps(numpy.asarray(values, dtype=float).reshape(-1))
+    sr("SetSynapseProperty")
+
+
+@check_stack
+def DumpConnectome(prefix, source=None, target=None, synapse_model=None,
+                   synapse_label=None):
+    """Write connections to binary connectome files.
+
+    Each MPI process writes the connections to its local targets to the
+    file prefix-<rank>.conn. The files store source, target, weight,
+    delay and synapse model of each connection and can be loaded with
+    the connection rule 'from_file'.
+
+    Parameters
+    ----------
+    prefix : str
+        Path and prefix of the file names
+    source : list, optional
+        Source GIDs, only connections from these
+        pre-synaptic neurons are written
+    target : list, optional
+        Target GIDs, only connections to these
+        post-synaptic neurons are written
+    synapse_model : str, optional
+        Only connections with this synapse type are written
+    synapse_label : int, optional
+        (non-negative) only connections with this synapse label are written
+
+    Raises
+    ------
+    TypeError
+        Description
+    """
+
+    params = {}
+
+    if source is not None:
+        if not is_coercible_to_sli_array(source):
+            raise TypeError("source must be a list of GIDs")
+        params['source'] = source
+
+    if target is not None:
+        if not is_coercible_to_sli_array(target):
+            raise TypeError("target must be a list of GIDs")
+        params['target'] = target
+
+    if synapse_model is not None:
+        params['synapse_model'] = kernel.SLILiteral(synapse_model)
+
+    if synapse_label is not None:
+        params['synapse_label'] = synapse_label
+
+    sps(prefix)
+    sps(params)
+    sr("DumpConnectome")
+
+
 @check_stack
 def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
     """
@@ -148,6 +356,7 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
     - 'fixed_outdegree', 'outdegree'
     - 'fixed_total_number', 'N'
     - 'pairwise_bernoulli', 'p'
+    - 'from_file', 'filename' (prefix of files written by DumpConnectome)
 
     Example conn-spec choices
     ~~~~~~~~~~~~~~~~~~~~~~~~~
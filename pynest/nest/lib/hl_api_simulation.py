@@ -106,6 +106,46 @@ def RunManager():
         Cleanup()
 
 
+@check_stack
+def SaveCheckpoint(prefix):
+    """Write the state of the simulation to checkpoint files.
+
+    Each MPI process writes the file prefix-<rank>.ckpt, which contains
+    the simulation time, the states of the random number generators, all
+    connections and the dynamic state of all neurons. Parameters are not
+    stored. Only some neuron and synapse models and generators without
+    dynamic state support checkpoints, see the SLI documentation of
+    SaveCheckpoint; others raise NotImplemented.
+
+    Parameters
+    ----------
+    prefix : str
+        Path and prefix of the file names
+    """
+
+    sps(prefix)
+    sr('SaveCheckpoint')
+
+
+@check_stack
+def RestoreCheckpoint(prefix):
+    """Restore the state of the simulation from checkpoint files.
+
+    The nodes must have been recreated with the same models, parameters
+    and kernel settings as when the checkpoint was written, but must
+    neither be connected nor simulated. The number of MPI processes and
+    threads must be the same.
+
+    Parameters
+    ----------
+    prefix : str
+        Path and prefix of the file names given to SaveCheckpoint
+    """
+
+    sps(prefix)
+    sr('RestoreCheckpoint')
+
+
 @check_stack
 def ResumeSimulation():
     """Resume an interrupted simulation.